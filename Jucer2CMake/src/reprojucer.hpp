@@ -810,6 +810,7 @@ inline void writeReprojucerCMakeLists(const Arguments& args,
             jucerProject, "pluginFormats", "PLUGIN_FORMATS",
             [&jucerVersionAsTuple, &vstIsLegacy](const juce::String& value) {
               const auto supportsUnity = jucerVersionAsTuple >= Version{5, 3, 2};
+              const auto supportsLV2 = jucerVersionAsTuple >= Version{7, 0, 0};
               return convertIdsToStrings(
                 juce::StringArray::fromTokens(value, ",", {}),
                 {{vstIsLegacy ? "" : "buildVST", vstIsLegacy ? "" : "VST"},
@@ -820,6 +821,7 @@ inline void writeReprojucerCMakeLists(const Arguments& args,
                  {"buildAAX", "AAX"},
                  {"buildStandalone", "Standalone"},
                  {supportsUnity ? "buildUnity" : "", supportsUnity ? "Unity" : ""},
+                 {supportsLV2 ? "buildLv2" : "", supportsLV2 ? "LV2" : ""},
                  {"enableIAA", "Enable IAA"},
                  {vstIsLegacy ? "buildVST" : "", vstIsLegacy ? "VST (Legacy)" : ""}});
             });
@@ -1097,6 +1099,11 @@ inline void writeReprojucerCMakeLists(const Arguments& args,
         convertSetting(jucerProject, "aaxIdentifier", "PLUGIN_AAX_IDENTIFIER", {});
       }
 
+      if (jucerVersionAsTuple >= Version{7, 0, 0})
+      {
+        convertSettingIfDefined(jucerProject, "lv2Uri", "PLUGIN_LV2_URI", {});
+      }
+
       wLn(")");
       wLn();
     }
@@ -2639,6 +2646,8 @@ inline void writeReprojucerCMakeLists(const Arguments& args,
                                   "UNITY_BINARY_LOCATION", {});
           convertSettingIfDefined(configuration, "vstBinaryLocation",
                                   "VST_LEGACY_BINARY_LOCATION", {});
+          convertSettingIfDefined(configuration, "lv2BinaryLocation",
+                                  "LV2_BINARY_LOCATION", {});
         }
 
         const auto codeBlocksArchitecture =
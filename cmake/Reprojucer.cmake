@@ -120,6 +120,9 @@ function(jucer_project_settings)
     "BINARYDATACPP_SIZE_LIMIT"
     "INCLUDE_BINARYDATA"
     "BINARYDATA_NAMESPACE"
+    "STABLE_BINARYDATA_HEADER"
+    "RELOCATION_FREE_BINARYDATA"
+    "LINK_TIME_PROJECT_VERSION"
     "CXX_LANGUAGE_STANDARD"
     "POST_EXPORT_SHELL_COMMAND_MACOS_LINUX"
     "POST_EXPORT_SHELL_COMMAND_WINDOWS"
@@ -210,6 +213,7 @@ function(jucer_audio_plugin_settings)
     "BUILD_AAX"
     "BUILD_STANDALONE_PLUGIN"
     "BUILD_UNITY_PLUGIN"
+    "BUILD_LV2"
     "ENABLE_INTER_APP_AUDIO"
   )
   set(plugin_characteristics_keywords
@@ -237,6 +241,7 @@ function(jucer_audio_plugin_settings)
     "PLUGIN_VST_LEGACY_CATEGORY"
     "PLUGIN_VST_CATEGORY"
     "VST_CATEGORY"
+    "PLUGIN_LV2_URI"
   )
   set(multi_value_keywords
     "PLUGIN_FORMATS"
@@ -257,12 +262,21 @@ function(jucer_audio_plugin_settings)
     endif()
   endif()
 
+  if(DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 7.0.0)
+    if(DEFINED _BUILD_LV2)
+      message(WARNING "BUILD_LV2 is a JUCE 7 feature only")
+    endif()
+    if(DEFINED _PLUGIN_LV2_URI)
+      message(WARNING "PLUGIN_LV2_URI is a JUCE 7 feature only")
+    endif()
+  endif()
+
   if(DEFINED _PLUGIN_FORMATS)
     set(plugin_formats_vars ${plugin_formats_keywords} "BUILD_VST")
     set(plugin_formats_values "VST" "VST3" "AU" "AUv3" "RTAS" "AAX" "Standalone"
-      "Unity" "Enable IAA" "VST (Legacy)"
+      "Unity" "LV2" "Enable IAA" "VST (Legacy)"
     )
-    foreach(index RANGE 9)
+    foreach(index RANGE 10)
       list(GET plugin_formats_vars ${index} format_var)
       if(NOT DEFINED _${format_var})
         list(GET plugin_formats_values ${index} format_value)
@@ -532,6 +546,13 @@ function(jucer_project_module module_name PATH_KEYWORD modules_folder)
       endif()
     endif()
 
+    if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 7.0.0))
+      if(src_file MATCHES "_LV2[._]"
+          AND NOT (JUCER_BUILD_LV2 AND CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux"))
+        set(to_compile FALSE)
+      endif()
+    endif()
+
     if(NOT DEFINED to_compile)
       get_filename_component(src_file_extension "${src_file}" EXT)
       if(src_file_extension STREQUAL ".mm")
@@ -873,9 +894,31 @@ function(jucer_export_target exporter)
     list(APPEND single_value_keywords "GNU_COMPILER_EXTENSIONS")
   endif()
 
+  if(exporter MATCHES "^Xcode \\((macOS|iOS)\\)$"
+      OR exporter MATCHES "^Visual Studio 20(22|1[9753])$")
+    list(APPEND multi_value_keywords
+      "PREBUILD_INPUTS"
+      "PREBUILD_OUTPUTS"
+      "POSTBUILD_INPUTS"
+      "POSTBUILD_OUTPUTS"
+    )
+  endif()
+
   if(exporter STREQUAL "Linux Makefile")
-    list(APPEND single_value_keywords "CXX_STANDARD_TO_USE")
-    list(APPEND multi_value_keywords "PKGCONFIG_LIBRARIES")
+    list(APPEND single_value_keywords
+      "CXX_STANDARD_TO_USE"
+      "LINK_AS_NEEDED"
+      "USE_IPP_LIBRARY"
+      "USE_IPP_LIBRARY_ONE_API"
+    )
+    list(APPEND multi_value_keywords
+      "PKGCONFIG_LIBRARIES"
+      "VST_UNLINKED_PACKAGES"
+      "VST3_UNLINKED_PACKAGES"
+      "STANDALONE_UNLINKED_PACKAGES"
+      "UNITY_UNLINKED_PACKAGES"
+      "LV2_UNLINKED_PACKAGES"
+    )
   endif()
 
   if(exporter STREQUAL "Code::Blocks (Windows)")
@@ -1523,9 +1566,25 @@ function(jucer_export_target exporter)
   endif()
 
   if(DEFINED _USE_IPP_LIBRARY_ONE_API)
-    _FRUT_warn_about_unsupported_setting(
-      "USE_IPP_LIBRARY_ONE_API" "Use IPP Library (oneAPI)" 739
-    )
+    if(exporter STREQUAL "Linux Makefile")
+      set(ipp_library "${_USE_IPP_LIBRARY_ONE_API}")
+      set(ipp_library_values
+        "Yes (Default Linking)"
+        "Static Library"
+        "Dynamic Library"
+      )
+      if(ipp_library IN_LIST ipp_library_values)
+        set(JUCER_USE_IPP_LIBRARY_ONE_API "${ipp_library}" PARENT_SCOPE)
+      elseif(NOT ipp_library STREQUAL "No")
+        message(FATAL_ERROR
+          "Unsupported value for USE_IPP_LIBRARY_ONE_API: \"${ipp_library}\""
+        )
+      endif()
+    else()
+      _FRUT_warn_about_unsupported_setting(
+        "USE_IPP_LIBRARY_ONE_API" "Use IPP Library (oneAPI)" 739
+      )
+    endif()
   endif()
 
   if(DEFINED _USE_MKL_LIBRARY_ONE_API)
@@ -1568,6 +1627,35 @@ function(jucer_export_target exporter)
     set(JUCER_PKGCONFIG_LIBRARIES "${_PKGCONFIG_LIBRARIES}" PARENT_SCOPE)
   endif()
 
+  if(DEFINED _LINK_AS_NEEDED)
+    set(JUCER_LINK_AS_NEEDED "${_LINK_AS_NEEDED}" PARENT_SCOPE)
+  endif()
+
+  foreach(format IN ITEMS "VST" "VST3" "STANDALONE" "UNITY" "LV2")
+    if(DEFINED _${format}_UNLINKED_PACKAGES)
+      set(JUCER_${format}_UNLINKED_PACKAGES "${_${format}_UNLINKED_PACKAGES}"
+        PARENT_SCOPE
+      )
+    endif()
+  endforeach()
+
+  foreach(step IN ITEMS "PREBUILD" "POSTBUILD")
+    if(DEFINED _${step}_INPUTS AND NOT DEFINED _${step}_OUTPUTS)
+      message(FATAL_ERROR "${step}_INPUTS requires ${step}_OUTPUTS")
+    endif()
+    foreach(kind IN ITEMS "INPUTS" "OUTPUTS")
+      if(DEFINED _${step}_${kind})
+        set(paths "")
+        foreach(path IN LISTS _${step}_${kind})
+          file(TO_CMAKE_PATH "${path}" path)
+          _FRUT_abs_path_based_on_jucer_project_dir(path "${path}")
+          list(APPEND paths "${path}")
+        endforeach()
+        set(JUCER_${step}_${kind} "${paths}" PARENT_SCOPE)
+      endif()
+    endforeach()
+  endforeach()
+
   if(DEFINED _TARGET_PLATFORM)
     set(target_platform "${_TARGET_PLATFORM}")
     set(target_platform_values "Default" "Windows NT 4.0" "Windows 2000" "Windows XP"
@@ -1723,6 +1811,9 @@ function(jucer_export_target_configuration
       "VST3_BINARY_LOCATION"
       "UNITY_BINARY_LOCATION"
       "VST_LEGACY_BINARY_LOCATION"
+      "LV2_BINARY_LOCATION"
+      "BINARY_SIZE_BUDGET"
+      "SPLIT_DEBUG_INFO"
     )
   endif()
 
@@ -1873,6 +1964,24 @@ function(jucer_export_target_configuration
     set(JUCER_VST_BINARY_LOCATION_${config} "${binary_location}" PARENT_SCOPE)
   endif()
 
+  if(DEFINED _LV2_BINARY_LOCATION)
+    _FRUT_sanitize_path_in_user_folder(binary_location "${_LV2_BINARY_LOCATION}")
+    set(JUCER_LV2_BINARY_LOCATION_${config} "${binary_location}" PARENT_SCOPE)
+  endif()
+
+  if(DEFINED _BINARY_SIZE_BUDGET)
+    if(NOT _BINARY_SIZE_BUDGET MATCHES "^[0-9]+$")
+      message(FATAL_ERROR
+        "Unsupported value for BINARY_SIZE_BUDGET: \"${_BINARY_SIZE_BUDGET}\""
+      )
+    endif()
+    set(JUCER_BINARY_SIZE_BUDGET_${config} "${_BINARY_SIZE_BUDGET}" PARENT_SCOPE)
+  endif()
+
+  if(DEFINED _SPLIT_DEBUG_INFO)
+    set(JUCER_SPLIT_DEBUG_INFO_${config} "${_SPLIT_DEBUG_INFO}" PARENT_SCOPE)
+  endif()
+
   if(DEFINED _MACOS_BASE_SDK)
     set(JUCER_MACOS_BASE_SDK_${config} "${_MACOS_BASE_SDK}" PARENT_SCOPE)
   endif()
@@ -2271,6 +2380,31 @@ function(jucer_export_target_configuration
 endfunction()
 
 
+function(jucer_add_benchmark name)
+
+  _FRUT_parse_arguments("" "SOURCES" "${ARGN}")
+
+  if(NOT DEFINED _SOURCES)
+    message(FATAL_ERROR "Missing SOURCES argument")
+  endif()
+
+  if(name IN_LIST JUCER_BENCHMARKS)
+    message(FATAL_ERROR "There is already a benchmark named \"${name}\"")
+  endif()
+
+  set(sources "")
+  foreach(path IN LISTS _SOURCES)
+    _FRUT_abs_path_based_on_jucer_project_dir(path "${path}")
+    list(APPEND sources "${path}")
+  endforeach()
+
+  list(APPEND JUCER_BENCHMARKS "${name}")
+  set(JUCER_BENCHMARKS "${JUCER_BENCHMARKS}" PARENT_SCOPE)
+  set(JUCER_BENCHMARK_${name}_SOURCES "${sources}" PARENT_SCOPE)
+
+endfunction()
+
+
 function(jucer_project_end)
 
   unset(current_exporter)
@@ -2430,6 +2564,25 @@ function(jucer_project_end)
   _FRUT_generate_AppConfig_and_JucePluginDefines_header()
   _FRUT_generate_JuceHeader_header()
 
+  option(JUCER_CONSOLIDATE_HEADER_SEARCH_PATHS
+    "If ON, remove duplicate and non-existent header search paths"
+  )
+  option(JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM
+    "If ON, merge the header search paths into a single folder of symbolic links"
+  )
+  if(JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM)
+    set(JUCER_CONSOLIDATE_HEADER_SEARCH_PATHS ON)
+  endif()
+  if(JUCER_CONSOLIDATE_HEADER_SEARCH_PATHS)
+    _FRUT_consolidate_header_search_paths("${current_exporter}")
+  endif()
+
+  if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+    option(JUCER_BINARY_SIZE_REPORT
+      "If ON, report section sizes, relocations and largest symbols after each build"
+    )
+  endif()
+
   if(DEFINED JUCER_SMALL_ICON OR DEFINED JUCER_LARGE_ICON)
     unset(icon_filename)
     if(APPLE)
@@ -2491,6 +2644,52 @@ function(jucer_project_end)
     list(APPEND modules_sources ${module_sources})
   endforeach()
 
+  # Benchmarks and the editor benchmark of GUI Application projects reuse the compiled
+  # JUCE modules. Audio Plug-in and Static Library projects already provide them through
+  # a library target; other projects compile them in an OBJECT library whose objects are
+  # added to both the main target and the benchmarks.
+  unset(modules_objects)
+  if(JUCER_PROJECT_TYPE STREQUAL "Console Application")
+    set(benchmark_target_type "ConsoleApp")
+  elseif(JUCER_PROJECT_TYPE STREQUAL "GUI Application")
+    set(benchmark_target_type "GUIApp")
+  elseif(JUCER_PROJECT_TYPE STREQUAL "Static Library")
+    set(benchmark_target_type "StaticLibrary")
+  elseif(JUCER_PROJECT_TYPE STREQUAL "Dynamic Library")
+    set(benchmark_target_type "DynamicLibrary")
+  else()
+    set(benchmark_target_type "SharedCodeTarget")
+  endif()
+  if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux"
+      AND (JUCER_PROJECT_TYPE STREQUAL "GUI Application"
+        OR JUCER_PROJECT_TYPE STREQUAL "Audio Plug-in"))
+    option(JUCER_BUILD_EDITOR_BENCHMARK
+      "If ON, add a <target>_EditorBenchmark executable that times the editor's painting"
+    )
+  endif()
+  set(build_editor_benchmark FALSE)
+  if(JUCER_BUILD_EDITOR_BENCHMARK AND CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux"
+      AND (JUCER_PROJECT_TYPE STREQUAL "GUI Application"
+        OR JUCER_PROJECT_TYPE STREQUAL "Audio Plug-in"))
+    set(build_editor_benchmark TRUE)
+  endif()
+  if((DEFINED JUCER_BENCHMARKS OR build_editor_benchmark) AND modules_sources
+      AND NOT JUCER_PROJECT_TYPE STREQUAL "Audio Plug-in"
+      AND NOT JUCER_PROJECT_TYPE STREQUAL "Static Library")
+    if(CMAKE_VERSION VERSION_LESS 3.12)
+      message(FATAL_ERROR "jucer_add_benchmark() and JUCER_BUILD_EDITOR_BENCHMARK require"
+        " CMake version 3.12 minimum on ${JUCER_PROJECT_TYPE} projects"
+      )
+    endif()
+    add_library(${target}_JUCE_Modules OBJECT ${modules_sources})
+    _FRUT_set_compiler_and_linker_settings(
+      ${target}_JUCE_Modules "${benchmark_target_type}" "${current_exporter}"
+    )
+    _FRUT_set_custom_xcode_flags(${target}_JUCE_Modules)
+    set(modules_objects "$<TARGET_OBJECTS:${target}_JUCE_Modules>")
+    set(modules_sources "${modules_objects}")
+  endif()
+
   set(all_sources
     ${JUCER_PROJECT_FILES}
     ${modules_sources}
@@ -2527,6 +2726,28 @@ function(jucer_project_end)
     _FRUT_link_xcode_frameworks(${target} "${current_exporter}")
     _FRUT_set_custom_xcode_flags(${target})
 
+    if(build_editor_benchmark)
+      # START_JUCE_APPLICATION() doesn't define main() when
+      # JUCE_GUI_APPLICATION_DEFINE_CUSTOM_MAIN is defined, so the project files can be
+      # compiled again together with the benchmark's main()
+      set(editor_benchmark_target "${target}_EditorBenchmark")
+      add_executable(${editor_benchmark_target}
+        ${JUCER_PROJECT_FILES}
+        ${modules_sources}
+        "${Reprojucer_data_DIR}/audio_plugin_harness.h"
+        "${Reprojucer_data_DIR}/editor_benchmark.cpp"
+      )
+      target_compile_definitions(${editor_benchmark_target} PRIVATE
+        "JUCE_GUI_APPLICATION_DEFINE_CUSTOM_MAIN=1"
+        "FRUT_EDITOR_BENCHMARK_GUI_APPLICATION=1"
+      )
+      _FRUT_set_output_directory_properties(${editor_benchmark_target} "Harnesses")
+      _FRUT_set_compiler_and_linker_settings(
+        ${editor_benchmark_target} "GUIApp" "${current_exporter}"
+      )
+      unset(editor_benchmark_target)
+    endif()
+
   elseif(JUCER_PROJECT_TYPE STREQUAL "Static Library")
     add_library(${target} STATIC ${all_sources})
     _FRUT_set_product_bundle_identifier(${target})
@@ -2567,6 +2788,7 @@ function(jucer_project_end)
     set(VST3_sources "")
     set(Standalone_sources "")
     set(Unity_sources "")
+    set(LV2_sources "")
     set(SharedCode_sources "")
     foreach(src_file IN LISTS JUCER_PROJECT_FILES modules_sources)
       # See Project::getTargetTypeFromFilePath()
@@ -2587,6 +2809,8 @@ function(jucer_project_end)
         list(APPEND Standalone_sources "${src_file}")
       elseif(src_file MATCHES "_Unity[._]")
         list(APPEND Unity_sources "${src_file}")
+      elseif(src_file MATCHES "_LV2[._]")
+        list(APPEND LV2_sources "${src_file}")
       else()
         list(APPEND SharedCode_sources "${src_file}")
       endif()
@@ -2612,6 +2836,84 @@ function(jucer_project_end)
     target_compile_definitions(${shared_code_target} PRIVATE "JUCE_SHARED_CODE=1")
     _FRUT_set_custom_xcode_flags(${shared_code_target})
 
+    option(JUCER_BUILD_AUDIO_PLUGIN_BENCHMARK
+      "If ON, add a <target>_Benchmark executable that times processBlock()"
+    )
+    if(JUCER_BUILD_AUDIO_PLUGIN_BENCHMARK AND NOT IOS)
+      _FRUT_add_audio_plugin_harness("${target}_Benchmark" ${shared_code_target}
+        "${current_exporter}" "${Reprojucer_data_DIR}/audio_plugin_benchmark.cpp"
+      )
+    endif()
+
+    option(JUCER_BUILD_AUDIO_PLUGIN_REALTIME_SAFETY_CHECK
+      "If ON, add a <target>_RealtimeSafetyCheck executable that checks processBlock()"
+    )
+    if(JUCER_BUILD_AUDIO_PLUGIN_REALTIME_SAFETY_CHECK AND NOT IOS)
+      set(rt_check_target "${target}_RealtimeSafetyCheck")
+      _FRUT_add_audio_plugin_harness(${rt_check_target} ${shared_code_target}
+        "${current_exporter}"
+        "${Reprojucer_data_DIR}/audio_plugin_allocation_hooks.h"
+        "${Reprojucer_data_DIR}/audio_plugin_realtime_safety_check.cpp"
+      )
+      if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+        set_property(TARGET ${rt_check_target} APPEND_STRING PROPERTY
+          LINK_FLAGS " -rdynamic"
+        )
+        target_link_libraries(${rt_check_target} PRIVATE ${CMAKE_DL_LIBS})
+      endif()
+      add_test(NAME ${rt_check_target} COMMAND ${rt_check_target})
+      unset(rt_check_target)
+    endif()
+
+    option(JUCER_BUILD_AUDIO_PLUGIN_SCALING_BENCHMARK
+      "If ON, add a <target>_ScalingBenchmark executable that runs many instances"
+    )
+    if(JUCER_BUILD_AUDIO_PLUGIN_SCALING_BENCHMARK AND NOT IOS)
+      _FRUT_add_audio_plugin_harness("${target}_ScalingBenchmark" ${shared_code_target}
+        "${current_exporter}" "${Reprojucer_data_DIR}/audio_plugin_scaling_benchmark.cpp"
+      )
+    endif()
+
+    option(JUCER_BUILD_AUDIO_PLUGIN_RENDER
+      "If ON, add a <target>_Render executable that renders audio files offline"
+    )
+    if(JUCER_BUILD_AUDIO_PLUGIN_RENDER AND NOT IOS)
+      if(NOT "juce_audio_formats" IN_LIST JUCER_PROJECT_MODULES)
+        message(FATAL_ERROR
+          "JUCER_BUILD_AUDIO_PLUGIN_RENDER requires the juce_audio_formats module"
+        )
+      endif()
+      _FRUT_add_audio_plugin_harness("${target}_Render" ${shared_code_target}
+        "${current_exporter}" "${Reprojucer_data_DIR}/audio_plugin_render.cpp"
+      )
+    endif()
+
+    option(JUCER_BUILD_AUDIO_PLUGIN_STATE_BENCHMARK
+      "If ON, add a <target>_StateBenchmark executable that times state round-trips"
+    )
+    if(JUCER_BUILD_AUDIO_PLUGIN_STATE_BENCHMARK AND NOT IOS)
+      _FRUT_add_audio_plugin_harness("${target}_StateBenchmark" ${shared_code_target}
+        "${current_exporter}"
+        "${Reprojucer_data_DIR}/audio_plugin_allocation_hooks.h"
+        "${Reprojucer_data_DIR}/audio_plugin_state_benchmark.cpp"
+      )
+    endif()
+
+    option(JUCER_BUILD_AUDIO_PLUGIN_FOOTPRINT_AUDIT
+      "If ON, add a <target>_FootprintAudit executable that measures memory and threads"
+    )
+    if(JUCER_BUILD_AUDIO_PLUGIN_FOOTPRINT_AUDIT AND NOT IOS)
+      _FRUT_add_audio_plugin_harness("${target}_FootprintAudit" ${shared_code_target}
+        "${current_exporter}" "${Reprojucer_data_DIR}/audio_plugin_footprint_audit.cpp"
+      )
+    endif()
+
+    if(build_editor_benchmark)
+      _FRUT_add_audio_plugin_harness("${target}_EditorBenchmark" ${shared_code_target}
+        "${current_exporter}" "${Reprojucer_data_DIR}/editor_benchmark.cpp"
+      )
+    endif()
+
     if(JUCER_BUILD_VST AND NOT IOS)
       set(vst_target "${target}_VST")
       add_library(${vst_target} MODULE
@@ -2676,6 +2978,14 @@ function(jucer_project_end)
         ${vst3_target} "VST3PlugIn" "${current_exporter}"
       )
       _FRUT_add_extra_commands(${vst3_target} "${current_exporter}")
+      if(APPLE OR CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+        option(JUCER_GENERATE_VST3_MODULEINFO
+          "If ON, write Contents/Resources/moduleinfo.json into the VST3 bundle" OFF
+        )
+        if(JUCER_GENERATE_VST3_MODULEINFO)
+          _FRUT_add_VST3_moduleinfo_command(${vst3_target})
+        endif()
+      endif()
       if(APPLE)
         _FRUT_install_to_plugin_binary_location(${vst3_target} "VST3"
           "$ENV{HOME}/Library/Audio/Plug-Ins/VST3"
@@ -2740,13 +3050,7 @@ function(jucer_project_end)
         endforeach()
 
         if(should_install)
-          add_custom_command(TARGET ${vst3_target} POST_BUILD
-            COMMAND
-            "${CMAKE_COMMAND}"
-            "-DCMAKE_INSTALL_CONFIG_NAME=$<CONFIG>"
-            "-DCMAKE_INSTALL_COMPONENT=${component}"
-            "-P" "${CMAKE_CURRENT_BINARY_DIR}/cmake_install.cmake"
-          )
+          _FRUT_add_plugin_copy_step(${vst3_target} "${component}")
         endif()
       endif()
       _FRUT_link_xcode_frameworks(${vst3_target} "${current_exporter}")
@@ -3227,11 +3531,136 @@ function(jucer_project_end)
       unset(unity_target)
     endif()
 
+    if(JUCER_BUILD_LV2 AND CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux"
+        AND NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 7.0.0))
+      set(lv2_target "${target}_LV2")
+      add_library(${lv2_target} MODULE ${LV2_sources})
+      target_link_libraries(${lv2_target} PRIVATE ${shared_code_target})
+      _FRUT_set_output_directory_properties(${lv2_target} "LV2")
+      _FRUT_set_output_name_properties(${lv2_target})
+      # <name>.lv2/<name>.so, next to which the TTL files get written
+      foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+        string(TOUPPER "${config}" upper_config)
+        get_target_property(output_name ${lv2_target} OUTPUT_NAME_${upper_config})
+        set(lv2_dir "${output_name}.lv2")
+        get_target_property(
+          output_directory ${lv2_target} LIBRARY_OUTPUT_DIRECTORY_${upper_config}
+        )
+        if(output_directory)
+          set(lv2_dir "${output_directory}/${lv2_dir}")
+        endif()
+        set_target_properties(${lv2_target} PROPERTIES
+          LIBRARY_OUTPUT_DIRECTORY_${upper_config} "${lv2_dir}"
+        )
+      endforeach()
+      _FRUT_set_compiler_and_linker_settings(
+        ${lv2_target} "LV2PlugIn" "${current_exporter}"
+      )
+      string(CONCAT lv2_sdk_folder
+        "${JUCER_PROJECT_MODULE_juce_audio_processors_PATH}/"
+        "juce_audio_processors/format_types/LV2_SDK"
+      )
+      if(IS_DIRECTORY "${lv2_sdk_folder}")
+        target_include_directories(${lv2_target} PRIVATE
+          "${lv2_sdk_folder}"
+          "${lv2_sdk_folder}/lv2"
+        )
+      endif()
+      _FRUT_add_extra_commands(${lv2_target} "${current_exporter}")
+      _FRUT_add_LV2_manifest_command(${lv2_target})
+      _FRUT_install_to_plugin_binary_location(
+        ${lv2_target} "LV2" "$ENV{HOME}/.lv2" DIRECTORY
+      )
+      unset(lv2_target)
+    endif()
+
+    if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+      option(JUCER_BUILD_AUDIO_PLUGIN_LOAD_BENCHMARK
+        "If ON, add a <target>_LoadBenchmark executable that times loading the plugin"
+      )
+    endif()
+    if(JUCER_BUILD_AUDIO_PLUGIN_LOAD_BENCHMARK
+        AND CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux"
+        AND (TARGET ${target}_VST3 OR TARGET ${target}_StandalonePlugin))
+      # Doesn't link against ${shared_code_target}, since the plugin's dependencies must
+      # not be loaded already when the VST3 module gets loaded
+      set(load_benchmark_target "${target}_LoadBenchmark")
+      add_executable(${load_benchmark_target}
+        "${Reprojucer_data_DIR}/audio_plugin_load_benchmark.cpp"
+      )
+      _FRUT_set_output_directory_properties(${load_benchmark_target} "Harnesses")
+      _FRUT_set_cxx_language_standard_properties(${load_benchmark_target})
+      target_link_libraries(${load_benchmark_target} PRIVATE ${CMAKE_DL_LIBS})
+      if(TARGET ${target}_VST3)
+        _FRUT_get_VST3_SDK_folder(vst3_sdk_folder)
+        if(DEFINED vst3_sdk_folder)
+          target_include_directories(${load_benchmark_target} PRIVATE
+            "${vst3_sdk_folder}"
+          )
+          target_compile_definitions(${load_benchmark_target} PRIVATE
+            "FRUT_LOAD_BENCHMARK_HAS_VST3=1"
+          )
+        endif()
+        target_compile_definitions(${load_benchmark_target} PRIVATE
+          "FRUT_LOAD_BENCHMARK_VST3_MODULE=\"$<TARGET_FILE:${target}_VST3>\""
+        )
+        add_dependencies(${load_benchmark_target} ${target}_VST3)
+      endif()
+      if(TARGET ${target}_StandalonePlugin)
+        set(standalone_file "$<TARGET_FILE:${target}_StandalonePlugin>")
+        target_compile_definitions(${load_benchmark_target} PRIVATE
+          "FRUT_LOAD_BENCHMARK_STANDALONE_EXECUTABLE=\"${standalone_file}\""
+        )
+        add_dependencies(${load_benchmark_target} ${target}_StandalonePlugin)
+      endif()
+      unset(load_benchmark_target)
+    endif()
+
+    option(JUCER_PLUGIN_PRECOMPILED_HEADERS
+      "If ON, precompile JuceHeader.h for the Shared Code target"
+    )
+    if(JUCER_PLUGIN_PRECOMPILED_HEADERS)
+      if(CMAKE_VERSION VERSION_LESS 3.16)
+        message(FATAL_ERROR
+          "JUCER_PLUGIN_PRECOMPILED_HEADERS requires CMake version 3.16 minimum"
+        )
+      endif()
+      # The JUCE module sources define macros before including the module headers, so
+      # they must not see a precompiled JuceHeader.h
+      set_source_files_properties(${modules_sources}
+        PROPERTIES SKIP_PRECOMPILE_HEADERS ON
+      )
+      _FRUT_precompile_JuceHeader_header(${shared_code_target})
+    endif()
+
   else()
     message(FATAL_ERROR "Unknown project type: ${JUCER_PROJECT_TYPE}")
 
   endif()
 
+  foreach(benchmark IN LISTS JUCER_BENCHMARKS)
+    add_executable(${benchmark}
+      ${JUCER_BENCHMARK_${benchmark}_SOURCES}
+      "${Reprojucer_data_DIR}/benchmark/frut_benchmark.h"
+      "${Reprojucer_data_DIR}/benchmark/frut_benchmark_main.cpp"
+    )
+    target_include_directories(${benchmark} PRIVATE "${Reprojucer_data_DIR}/benchmark")
+    if(JUCER_PROJECT_TYPE STREQUAL "Audio Plug-in")
+      target_link_libraries(${benchmark} PRIVATE ${target}_Shared_Code)
+    elseif(JUCER_PROJECT_TYPE STREQUAL "Static Library")
+      target_link_libraries(${benchmark} PRIVATE ${target})
+    elseif(DEFINED modules_objects)
+      target_sources(${benchmark} PRIVATE ${modules_objects})
+    endif()
+    _FRUT_set_product_bundle_identifier(${benchmark})
+    _FRUT_set_output_directory_properties(${benchmark} "Benchmarks")
+    _FRUT_set_compiler_and_linker_settings(
+      ${benchmark} "${benchmark_target_type}" "${current_exporter}"
+    )
+    _FRUT_link_xcode_frameworks(${benchmark} "${current_exporter}")
+    _FRUT_set_custom_xcode_flags(${benchmark})
+  endforeach()
+
   if(WIN32)
     set(user_cmd "${JUCER_POST_EXPORT_SHELL_COMMAND_WINDOWS}")
   else()
@@ -3302,6 +3731,125 @@ function(_FRUT_abs_path_based_on_jucer_target_project_folder out_path in_path ex
 endfunction()
 
 
+function(_FRUT_add_audio_plugin_harness harness_target shared_code_target exporter)
+
+  add_executable(${harness_target}
+    ${ARGN}
+    "${Reprojucer_data_DIR}/audio_plugin_harness.h"
+  )
+  target_link_libraries(${harness_target} PRIVATE ${shared_code_target})
+  _FRUT_set_product_bundle_identifier(${harness_target})
+  _FRUT_set_output_directory_properties(${harness_target} "Harnesses")
+  _FRUT_set_compiler_and_linker_settings(
+    ${harness_target} "SharedCodeTarget" "${exporter}"
+  )
+  _FRUT_link_xcode_frameworks(${harness_target} "${exporter}")
+  _FRUT_set_custom_xcode_flags(${harness_target})
+
+endfunction()
+
+
+function(_FRUT_add_binary_size_report target)
+
+  set(all_confs_budget "")
+  foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+    if(DEFINED JUCER_BINARY_SIZE_BUDGET_${config})
+      string(APPEND all_confs_budget
+        "$<$<CONFIG:${config}>:${JUCER_BINARY_SIZE_BUDGET_${config}}>"
+      )
+    endif()
+  endforeach()
+  if(NOT JUCER_BINARY_SIZE_REPORT AND all_confs_budget STREQUAL "")
+    return()
+  endif()
+
+  if(CMAKE_VERSION VERSION_LESS 3.13)
+    message(FATAL_ERROR "JUCER_BINARY_SIZE_REPORT and BINARY_SIZE_BUDGET require"
+      " CMake version 3.13 minimum"
+    )
+  endif()
+
+  if(NOT EXISTS "${readelf_exe}")
+    unset(readelf_exe CACHE)
+  endif()
+  find_program(readelf_exe "readelf")
+  if(NOT readelf_exe)
+    message(FATAL_ERROR "Could not find readelf program")
+  endif()
+  if(NOT CMAKE_NM)
+    message(FATAL_ERROR "Could not find nm program")
+  endif()
+  if(NOT EXISTS "${cxxfilt_exe}")
+    unset(cxxfilt_exe CACHE)
+  endif()
+  find_program(cxxfilt_exe "c++filt")
+  if(NOT cxxfilt_exe)
+    set(cxxfilt_exe "")
+  endif()
+
+  if(JUCER_BINARY_SIZE_REPORT)
+    set(report_symbols ON)
+  else()
+    set(report_symbols OFF)
+  endif()
+
+  # Like the split debug info one, this POST_BUILD command runs before the ones that copy
+  # plugins to their binary location, so a plugin over budget doesn't get copied
+  string(REPLACE ";" "," modules "${JUCER_PROJECT_MODULES}")
+  add_custom_command(TARGET ${target} POST_BUILD
+    COMMAND
+    "${CMAKE_COMMAND}"
+    "-DTARGET_NAME=${target}"
+    "-DTARGET_FILE=$<TARGET_FILE:${target}>"
+    "-DREPORT_FILE=${CMAKE_CURRENT_BINARY_DIR}/SizeReports/$<CONFIG>/${target}.json"
+    "-DBUDGET=${all_confs_budget}"
+    "-DSYMBOLS=${report_symbols}"
+    "-DMODULES=${modules}"
+    "-DNM=${CMAKE_NM}"
+    "-DREADELF=${readelf_exe}"
+    "-DCXXFILT=${cxxfilt_exe}"
+    "-P" "${Reprojucer_data_DIR}/binary-size-report.cmake"
+    VERBATIM
+  )
+
+endfunction()
+
+
+function(_FRUT_add_build_step_with_outputs target step scripts)
+
+  # The pre-build (resp. post-build) step is a single custom command shared by all the
+  # targets, so that Ninja and Make can skip it when its outputs are up to date
+  string(REGEX REPLACE "[^A-Za-z0-9_.+-]" "_" step_target "${JUCER_PROJECT_NAME}")
+  if(step STREQUAL "PREBUILD")
+    string(APPEND step_target "_PreBuild")
+  else()
+    string(APPEND step_target "_PostBuild")
+  endif()
+
+  if(NOT TARGET ${step_target})
+    add_custom_command(OUTPUT ${JUCER_${step}_OUTPUTS}
+      COMMAND ${ARGN}
+      DEPENDS ${JUCER_${step}_INPUTS} ${scripts}
+      WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
+    )
+    if(step STREQUAL "PREBUILD")
+      add_custom_target(${step_target} DEPENDS ${JUCER_${step}_OUTPUTS})
+    else()
+      add_custom_target(${step_target} ALL DEPENDS ${JUCER_${step}_OUTPUTS})
+    endif()
+  endif()
+
+  if(step STREQUAL "PREBUILD")
+    add_dependencies(${target} ${step_target})
+  else()
+    # Run the post-build step again when any of the targets is relinked
+    list(GET JUCER_${step}_OUTPUTS 0 first_output)
+    add_custom_command(OUTPUT "${first_output}" APPEND DEPENDS ${target})
+  endif()
+
+endfunction()
+
+
 function(_FRUT_add_bundle_resources target)
 
   if(NOT APPLE)
@@ -3332,6 +3880,8 @@ function(_FRUT_add_extra_commands target exporter)
     _FRUT_add_extra_commands_APPLE(${target} "${exporter}")
   elseif(MSVC)
     _FRUT_add_extra_commands_MSVC(${target} "${exporter}")
+  elseif(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+    _FRUT_add_extra_commands_Linux(${target})
   endif()
 
 endfunction()
@@ -3348,7 +3898,7 @@ function(_FRUT_add_extra_commands_APPLE target exporter)
     if(NOT strip_exe)
       message(FATAL_ERROR "Could not find strip program")
     endif()
-    if(CMAKE_GENERATOR STREQUAL "Xcode")
+    if(DEFINED CMAKE_CONFIGURATION_TYPES)
       unset(all_confs_strip_exe)
       unset(all_confs_strip_opt)
       unset(all_confs_strip_arg)
@@ -3380,10 +3930,16 @@ function(_FRUT_add_extra_commands_APPLE target exporter)
     if(NOT IS_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
       file(MAKE_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
     endif()
-    add_custom_command(TARGET ${target} PRE_BUILD
-      COMMAND "/bin/sh" "${JUCER_PREBUILD_SHELL_SCRIPT}"
-      WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
-    )
+    if(DEFINED JUCER_PREBUILD_OUTPUTS)
+      _FRUT_add_build_step_with_outputs(${target} "PREBUILD"
+        "${JUCER_PREBUILD_SHELL_SCRIPT}" "/bin/sh" "${JUCER_PREBUILD_SHELL_SCRIPT}"
+      )
+    else()
+      add_custom_command(TARGET ${target} PRE_BUILD
+        COMMAND "/bin/sh" "${JUCER_PREBUILD_SHELL_SCRIPT}"
+        WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
+      )
+    endif()
   endif()
 
   if(DEFINED JUCER_POSTBUILD_SHELL_SCRIPT)
@@ -3395,21 +3951,76 @@ function(_FRUT_add_extra_commands_APPLE target exporter)
     if(NOT IS_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
       file(MAKE_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
     endif()
+    if(DEFINED JUCER_POSTBUILD_OUTPUTS)
+      _FRUT_add_build_step_with_outputs(${target} "POSTBUILD"
+        "${JUCER_POSTBUILD_SHELL_SCRIPT}" "/bin/sh" "${JUCER_POSTBUILD_SHELL_SCRIPT}"
+      )
+    else()
+      add_custom_command(TARGET ${target} POST_BUILD
+        COMMAND "/bin/sh" "${JUCER_POSTBUILD_SHELL_SCRIPT}"
+        WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
+      )
+    endif()
+  endif()
+
+endfunction()
+
+
+function(_FRUT_add_extra_commands_Linux target)
+
+  get_target_property(target_type ${target} TYPE)
+  if(NOT (target_type STREQUAL "EXECUTABLE" OR target_type STREQUAL "SHARED_LIBRARY"
+      OR target_type STREQUAL "MODULE_LIBRARY"))
+    return()
+  endif()
+
+  set(all_confs_split_debug_info "")
+  foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+    if(JUCER_SPLIT_DEBUG_INFO_${config})
+      string(APPEND all_confs_split_debug_info "$<$<CONFIG:${config}>:ON>")
+    endif()
+  endforeach()
+
+  if(NOT all_confs_split_debug_info STREQUAL "")
+    if(NOT EXISTS "${readelf_exe}")
+      unset(readelf_exe CACHE)
+    endif()
+    find_program(readelf_exe "readelf")
+    if(NOT readelf_exe)
+      message(FATAL_ERROR "Could not find readelf program")
+    endif()
+    if(NOT CMAKE_OBJCOPY)
+      message(FATAL_ERROR "Could not find objcopy program")
+    endif()
+
+    # This POST_BUILD command runs before the ones that copy plugins to their binary
+    # location, so the stripped binary is the one that gets copied
     add_custom_command(TARGET ${target} POST_BUILD
-      COMMAND "/bin/sh" "${JUCER_POSTBUILD_SHELL_SCRIPT}"
-      WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
+      COMMAND
+      "${CMAKE_COMMAND}"
+      "-DENABLED=${all_confs_split_debug_info}"
+      "-DTARGET_FILE=$<TARGET_FILE:${target}>"
+      "-DDEBUG_INFO_DIR=${CMAKE_CURRENT_BINARY_DIR}/DebugInfo"
+      "-DOBJCOPY=${CMAKE_OBJCOPY}"
+      "-DREADELF=${readelf_exe}"
+      "-P" "${Reprojucer_data_DIR}/split-debug-info.cmake"
+      VERBATIM
     )
   endif()
 
+  _FRUT_add_binary_size_report(${target})
+
 endfunction()
 
 
 function(_FRUT_add_extra_commands_MSVC target exporter)
 
   unset(all_confs_prebuild_command)
+  unset(prebuild_scripts)
   foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
     if(DEFINED JUCER_PREBUILD_COMMAND_${config})
       set(prebuild_command "${JUCER_PREBUILD_COMMAND_${config}}")
+      list(APPEND prebuild_scripts "${prebuild_command}")
       string(APPEND all_confs_prebuild_command
         $<$<CONFIG:${config}>:${prebuild_command}>
       )
@@ -3424,16 +4035,24 @@ function(_FRUT_add_extra_commands_MSVC target exporter)
     if(NOT IS_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
       file(MAKE_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
     endif()
-    add_custom_command(TARGET ${target} PRE_BUILD
-      COMMAND ${all_confs_prebuild_command}
-      WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
-    )
+    if(DEFINED JUCER_PREBUILD_OUTPUTS)
+      _FRUT_add_build_step_with_outputs(${target} "PREBUILD"
+        "${prebuild_scripts}" ${all_confs_prebuild_command}
+      )
+    else()
+      add_custom_command(TARGET ${target} PRE_BUILD
+        COMMAND ${all_confs_prebuild_command}
+        WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
+      )
+    endif()
   endif()
 
   unset(all_confs_postbuild_command)
+  unset(postbuild_scripts)
   foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
     if(DEFINED JUCER_POSTBUILD_COMMAND_${config})
       set(postbuild_command "${JUCER_POSTBUILD_COMMAND_${config}}")
+      list(APPEND postbuild_scripts "${postbuild_command}")
       string(APPEND all_confs_postbuild_command
         $<$<CONFIG:${config}>:${postbuild_command}>
       )
@@ -3448,15 +4067,75 @@ function(_FRUT_add_extra_commands_MSVC target exporter)
     if(NOT IS_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
       file(MAKE_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}")
     endif()
-    add_custom_command(TARGET ${target} POST_BUILD
-      COMMAND ${all_confs_postbuild_command}
-      WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
-    )
+    if(DEFINED JUCER_POSTBUILD_OUTPUTS)
+      _FRUT_add_build_step_with_outputs(${target} "POSTBUILD"
+        "${postbuild_scripts}" ${all_confs_postbuild_command}
+      )
+    else()
+      add_custom_command(TARGET ${target} POST_BUILD
+        COMMAND ${all_confs_postbuild_command}
+        WORKING_DIRECTORY "${JUCER_TARGET_PROJECT_FOLDER}"
+      )
+    endif()
   endif()
 
 endfunction()
 
 
+function(_FRUT_add_LV2_manifest_command lv2_target)
+
+  if(CMAKE_CROSSCOMPILING)
+    message(STATUS "Not generating the TTL files of ${lv2_target}, since the LV2 module"
+      " cannot be loaded when cross-compiling"
+    )
+    return()
+  endif()
+
+  _FRUT_build_and_install_tool("LV2ManifestGenerator" "0.1.0")
+
+  # Hosts read manifest.ttl and dsp.ttl without loading the module, so they are written
+  # next to it by the module itself. This POST_BUILD command runs before the command
+  # that copies the bundle to the LV2 binary location.
+  add_custom_command(TARGET ${lv2_target} POST_BUILD
+    COMMAND "${LV2ManifestGenerator_exe}" "$<TARGET_FILE:${lv2_target}>"
+    WORKING_DIRECTORY "$<TARGET_FILE_DIR:${lv2_target}>"
+  )
+
+endfunction()
+
+
+function(_FRUT_add_plugin_copy_step target component)
+
+  set(copy_command
+    "${CMAKE_COMMAND}"
+    "-DCMAKE_INSTALL_CONFIG_NAME=$<CONFIG>"
+    "-DCMAKE_INSTALL_COMPONENT=${component}"
+    "-P" "${CMAKE_CURRENT_BINARY_DIR}/cmake_install.cmake"
+  )
+
+  if(NOT CMAKE_GENERATOR STREQUAL "Ninja Multi-Config")
+    add_custom_command(TARGET ${target} POST_BUILD COMMAND ${copy_command})
+    return()
+  endif()
+
+  # Ninja Multi-Config can build several configurations at once, which usually copy the
+  # plugin to the same destination. The copy step is a separate target built for each
+  # configuration after the plugin, and only these targets are serialized by a job pool
+  # of size 1, so that the plugins themselves are still linked in parallel.
+  set(job_pool "_FRUT_plugin_copy_step")
+  get_property(job_pools GLOBAL PROPERTY JOB_POOLS)
+  if(NOT "${job_pool}=1" IN_LIST job_pools)
+    set_property(GLOBAL APPEND PROPERTY JOB_POOLS "${job_pool}=1")
+  endif()
+  add_custom_target(${target}_CopyStep ALL
+    COMMAND ${copy_command}
+    JOB_POOL "${job_pool}"
+  )
+  add_dependencies(${target}_CopyStep ${target})
+
+endfunction()
+
+
 function(_FRUT_add_Rez_command_to_AU_plugin au_target)
 
   if(NOT EXISTS "${Rez_exe}")
@@ -3499,6 +4178,13 @@ function(_FRUT_add_Rez_command_to_AU_plugin au_target)
     endif()
   endforeach()
 
+  if(JUCER_LINK_TIME_PROJECT_VERSION)
+    # JucePluginDefines.h only defines the version for C++ code in that case (see
+    # _FRUT_set_JucePlugin_Version_defines()), and juce_AU_Resources.r only needs
+    # JucePlugin_VersionCode
+    list(APPEND rez_defines "-d" "JucePlugin_VersionCode=${JUCER_PROJECT_VERSION_AS_HEX}")
+  endif()
+
   string(CONCAT carbon_include_dir
     "/System/Library/Frameworks/CoreServices.framework/Frameworks/"
     "CarbonCore.framework/Versions/A/Headers"
@@ -3532,6 +4218,39 @@ function(_FRUT_add_Rez_command_to_AU_plugin au_target)
 endfunction()
 
 
+function(_FRUT_add_VST3_moduleinfo_command vst3_target)
+
+  if(CMAKE_CROSSCOMPILING)
+    message(STATUS "Not generating moduleinfo.json for ${vst3_target}, since the VST3"
+      " module cannot be loaded when cross-compiling"
+    )
+    return()
+  endif()
+
+  _FRUT_get_VST3_SDK_folder(vst3_sdk_folder)
+  if(NOT DEFINED vst3_sdk_folder)
+    message(STATUS "Not generating moduleinfo.json for ${vst3_target}, since the VST3"
+      " SDK could not be found"
+    )
+    return()
+  endif()
+
+  _FRUT_build_and_install_tool("VST3ModuleInfoGenerator" "0.1.0"
+    "-DVST3_SDK_FOLDER=${vst3_sdk_folder}"
+  )
+
+  # POST_BUILD commands only run when the module is relinked, and this one runs before
+  # the command that copies the bundle to the VST3 binary location
+  add_custom_command(TARGET ${vst3_target} POST_BUILD
+    COMMAND
+    "${VST3ModuleInfoGenerator_exe}"
+    "$<TARGET_FILE:${vst3_target}>"
+    "${JUCER_PROJECT_VERSION}"
+  )
+
+endfunction()
+
+
 function(_FRUT_bool_to_int bool_value out_int_value)
 
   if(bool_value)
@@ -3569,6 +4288,7 @@ function(_FRUT_build_and_install_tool tool_name tool_version)
         "-DCMAKE_INSTALL_PREFIX=${install_prefix}"
         "-Dbuilt_by_Reprojucer=TRUE"
         "-Dtool_to_build=${tool_name}"
+        ${ARGN}
       WORKING_DIRECTORY "${binary_dir}"
       OUTPUT_VARIABLE configure_output
       RESULT_VARIABLE configure_result
@@ -3851,6 +4571,75 @@ function(_FRUT_compute_vst3_category out_var)
 endfunction()
 
 
+function(_FRUT_consolidate_header_search_paths exporter)
+
+  if(JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM)
+    if(CMAKE_HOST_WIN32)
+      message(FATAL_ERROR
+        "JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM is not supported on Windows"
+      )
+    endif()
+    if(CMAKE_VERSION VERSION_LESS 3.14)
+      message(FATAL_ERROR
+        "JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM requires CMake version 3.14 minimum"
+      )
+    endif()
+  endif()
+
+  # The links are created at configure time, so the folders are re-created each time
+  # CMake runs, in order to pick up the headers that were added to the search paths since
+  # then (e.g. BinaryData.h once the project has resources)
+  set(farms_folder "${CMAKE_CURRENT_BINARY_DIR}/HeaderSearchPaths")
+  if(JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM)
+    file(REMOVE_RECURSE "${farms_folder}")
+  endif()
+
+  unset(common_search_paths)
+  set(all_configs_have_same_search_paths TRUE)
+
+  foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+    _FRUT_get_header_search_paths(search_paths "${exporter}" "${config}")
+
+    # The compiler looks for each #include in every search path in order until it finds
+    # the header, so search paths that appear twice or don't exist only cost lookups.
+    # Keeping the first occurrence of each search path preserves which header is found.
+    set(consolidated_search_paths "")
+    foreach(path IN LISTS search_paths)
+      get_filename_component(path "${path}" REALPATH)
+      if(IS_DIRECTORY "${path}" AND NOT path IN_LIST consolidated_search_paths)
+        list(APPEND consolidated_search_paths "${path}")
+      endif()
+    endforeach()
+
+    if(JUCER_HEADER_SEARCH_PATHS_SYMLINK_FARM)
+      string(MD5 farm_id "${consolidated_search_paths}")
+      set(farm_folder "${farms_folder}/${farm_id}")
+      if(NOT IS_DIRECTORY "${farm_folder}")
+        _FRUT_link_header_search_paths("${farm_folder}" "${consolidated_search_paths}")
+      endif()
+      set(consolidated_search_paths "${farm_folder}")
+    endif()
+
+    if(DEFINED common_search_paths
+        AND NOT common_search_paths STREQUAL consolidated_search_paths)
+      set(all_configs_have_same_search_paths FALSE)
+    endif()
+    set(common_search_paths "${consolidated_search_paths}")
+
+    set(JUCER_CONSOLIDATED_HEADER_SEARCH_PATHS_${config} "${consolidated_search_paths}"
+      PARENT_SCOPE
+    )
+  endforeach()
+
+  if(all_configs_have_same_search_paths)
+    set(JUCER_CONSOLIDATED_HEADER_SEARCH_PATHS "${common_search_paths}" PARENT_SCOPE)
+  else()
+    unset(JUCER_CONSOLIDATED_HEADER_SEARCH_PATHS PARENT_SCOPE)
+  endif()
+
+endfunction()
+
+
 function(_FRUT_create_xcassets_folder_from_icons out_var)
 
   _FRUT_build_and_install_tool("XcassetsBuilder" "0.1.0")
@@ -3998,6 +4787,10 @@ function(_FRUT_generate_AppConfig_and_JucePluginDefines_header)
       "// Audio plugin settings..\n\n"
     )
 
+    if(JUCER_LINK_TIME_PROJECT_VERSION)
+      list(REMOVE_ITEM audio_plugin_flags "Version" "VersionCode" "VersionString")
+    endif()
+
     foreach(flag IN LISTS audio_plugin_flags)
       string(LENGTH "JucePlugin_${flag}" right_padding)
       set(padding_spaces "")
@@ -4012,6 +4805,22 @@ function(_FRUT_generate_AppConfig_and_JucePluginDefines_header)
         "#endif\n"
       )
     endforeach()
+
+    if(JUCER_LINK_TIME_PROJECT_VERSION)
+      # The plugin format targets define these with compile definitions, see
+      # _FRUT_set_JucePlugin_Version_defines()
+      string(APPEND audio_plugin_settings_defines
+        "#if defined (__cplusplus) && ! defined (JucePlugin_VersionCode)\n"
+        " namespace ProjectInfo\n"
+        " {\n"
+        "     extern const char* const  versionString;\n"
+        "     extern const int          versionNumber;\n"
+        " }\n"
+        " #define JucePlugin_VersionCode            ProjectInfo::versionNumber\n"
+        " #define JucePlugin_VersionString          ProjectInfo::versionString\n"
+        "#endif\n"
+      )
+    endif()
   endif()
 
   if(DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 5.0.0)
@@ -4178,7 +4987,7 @@ function(_FRUT_generate_JuceHeader_header)
 
   list(LENGTH JUCER_PROJECT_RESOURCES resources_count)
   if(resources_count GREATER 0)
-    _FRUT_build_and_install_tool("BinaryDataBuilder" "0.3.1")
+    _FRUT_build_and_install_tool("BinaryDataBuilder" "0.5.0")
 
     if(DEFINED JUCER_VERSION)
       set(projucer_version "${JUCER_VERSION}")
@@ -4209,9 +5018,20 @@ function(_FRUT_generate_JuceHeader_header)
       ${size_limit_in_bytes}
       "${JUCER_BINARYDATA_NAMESPACE}"
     )
+    if(JUCER_STABLE_BINARYDATA_HEADER)
+      list(APPEND BinaryDataBuilder_args "--extern-sizes")
+    endif()
+    if(JUCER_RELOCATION_FREE_BINARYDATA)
+      list(APPEND BinaryDataBuilder_args "--relocation-free")
+    endif()
     foreach(resource_path IN LISTS JUCER_PROJECT_RESOURCES)
       get_filename_component(resource_abs_path "${resource_path}" ABSOLUTE)
       list(APPEND BinaryDataBuilder_args "${resource_abs_path}")
+      if(JUCER_STABLE_BINARYDATA_HEADER)
+        set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS
+          "${resource_abs_path}"
+        )
+      endif()
     endforeach()
     execute_process(
       COMMAND "${BinaryDataBuilder_exe}" ${BinaryDataBuilder_args}
@@ -4272,6 +5092,24 @@ function(_FRUT_generate_JuceHeader_header)
     )
   endif()
 
+  if(JUCER_LINK_TIME_PROJECT_VERSION)
+    string(CONCAT version_fields
+      "    extern const char* const  versionString;\n"
+      "    extern const int          versionNumber;"
+    )
+    configure_file("${Reprojucer_data_DIR}/ProjectVersion.cpp.in"
+      "JuceLibraryCode/ProjectVersion.cpp" @ONLY
+    )
+    list(APPEND JUCER_PROJECT_FILES
+      "${CMAKE_CURRENT_BINARY_DIR}/JuceLibraryCode/ProjectVersion.cpp"
+    )
+  else()
+    string(CONCAT version_fields
+      "    const char* const  versionString  = \"${JUCER_PROJECT_VERSION}\";\n"
+      "    const int          versionNumber  = ${JUCER_PROJECT_VERSION_AS_HEX};"
+    )
+  endif()
+
   if(DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 5.0.0)
     string(TOUPPER "${JUCER_PROJECT_ID}" upper_project_id)
     string(CONCAT include_guard_top
@@ -4934,6 +5772,9 @@ function(_FRUT_get_audio_plugin_flags out_var)
   if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 5.3.2))
     list(APPEND audio_plugin_flags "Build_Unity")
   endif()
+  if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 7.0.0))
+    list(APPEND audio_plugin_flags "Build_LV2")
+  endif()
   if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 5.0.0))
     list(APPEND audio_plugin_flags "Enable_IAA")
   endif()
@@ -4967,6 +5808,9 @@ function(_FRUT_get_audio_plugin_flags out_var)
       OR JUCER_VERSION VERSION_GREATER 5.4.1)
     list(APPEND audio_plugin_flags "VSTNumMidiInputs" "VSTNumMidiOutputs")
   endif()
+  if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 7.0.0))
+    list(APPEND audio_plugin_flags "LV2URI")
+  endif()
 
   _FRUT_bool_to_int("${JUCER_BUILD_VST}" Build_VST_value)
   _FRUT_bool_to_int("${JUCER_BUILD_VST3}" Build_VST3_value)
@@ -4983,6 +5827,12 @@ function(_FRUT_get_audio_plugin_flags out_var)
     _FRUT_bool_to_int("${JUCER_BUILD_STANDALONE_PLUGIN}" Build_Standalone_value)
   endif()
   _FRUT_bool_to_int("${JUCER_BUILD_UNITY_PLUGIN}" Build_Unity_value)
+  if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+    _FRUT_bool_to_int("${JUCER_BUILD_LV2}" Build_LV2_value)
+  else()
+    # The LV2 target is only created on Linux
+    set(Build_LV2_value 0)
+  endif()
   _FRUT_bool_to_int("${JUCER_ENABLE_INTER_APP_AUDIO}" Enable_IAA_value)
 
   set(Name_value "\"${JUCER_PLUGIN_NAME}\"")
@@ -5147,6 +5997,16 @@ function(_FRUT_get_audio_plugin_flags out_var)
     set(VSTNumMidiOutputs_value "16")
   endif()
 
+  if(DEFINED JUCER_PLUGIN_LV2_URI)
+    set(lv2_uri "${JUCER_PLUGIN_LV2_URI}")
+  else()
+    # See Project::getDefaultLV2URI()
+    # in JUCE/extras/Projucer/Source/Project/jucer_Project.h
+    string(REGEX REPLACE "[^A-Za-z0-9_]" "_" lv2_uri_name "${JUCER_PROJECT_NAME}")
+    set(lv2_uri "${JUCER_COMPANY_WEBSITE}/plugins/${lv2_uri_name}")
+  endif()
+  set(LV2URI_value "\"${lv2_uri}\"")
+
   string(LENGTH "${JUCER_PLUGIN_CHANNEL_CONFIGURATIONS}" plugin_channel_config_length)
   if(plugin_channel_config_length GREATER 0)
     # See Project::getAudioPluginFlags()::countMaxPluginChannels
@@ -5185,6 +6045,26 @@ function(_FRUT_get_audio_plugin_flags out_var)
 endfunction()
 
 
+function(_FRUT_get_header_search_paths out_var exporter config)
+
+  set(search_paths
+    "${CMAKE_CURRENT_BINARY_DIR}/JuceLibraryCode"
+    ${JUCER_PROJECT_MODULES_FOLDERS}
+    ${JUCER_PROJECT_MODULES_INTERNAL_SEARCH_PATHS}
+  )
+  foreach(path IN LISTS JUCER_HEADER_SEARCH_PATHS_${config} JUCER_HEADER_SEARCH_PATHS)
+    file(TO_CMAKE_PATH "${path}" path)
+    _FRUT_abs_path_based_on_jucer_target_project_folder(path "${path}" "${exporter}")
+    list(APPEND search_paths "${path}")
+  endforeach()
+  _FRUT_get_SDK_header_search_paths(sdk_search_paths)
+  list(APPEND search_paths ${sdk_search_paths})
+
+  set(${out_var} "${search_paths}" PARENT_SCOPE)
+
+endfunction()
+
+
 function(_FRUT_get_iaa_type_code out_var)
 
   if(JUCER_PLUGIN_MIDI_INPUT)
@@ -5206,6 +6086,51 @@ function(_FRUT_get_iaa_type_code out_var)
 endfunction()
 
 
+function(_FRUT_get_IPP_compile_definition out_var)
+
+  if(DEFINED JUCER_USE_IPP_LIBRARY_ONE_API)
+    set(use_ipp_library_values
+      "Yes (Default Linking)"
+      "Static Library"
+      "Dynamic Library"
+    )
+    set(ipp_compile_definitions
+      "_IPP_SEQUENTIAL_DYNAMIC"
+      "_IPP_SEQUENTIAL_STATIC"
+      "_IPP_SEQUENTIAL_DYNAMIC"
+    )
+    set(use_ipp_library "${JUCER_USE_IPP_LIBRARY_ONE_API}")
+  else()
+    set(use_ipp_library_values
+      "Yes (Default Mode)"
+      "Yes (Default Linking)"
+      "Multi-Threaded Static Library"
+      "Single-Threaded Static Library"
+      "Multi-Threaded DLL"
+      "Single-Threaded DLL"
+    )
+    set(ipp_compile_definitions
+      "_IPP_SEQUENTIAL_DYNAMIC"
+      "_IPP_SEQUENTIAL_DYNAMIC"
+      "_IPP_PARALLEL_STATIC"
+      "_IPP_SEQUENTIAL_STATIC"
+      "_IPP_PARALLEL_DYNAMIC"
+      "_IPP_SEQUENTIAL_DYNAMIC"
+    )
+    set(use_ipp_library "${JUCER_USE_IPP_LIBRARY}")
+  endif()
+
+  list(FIND use_ipp_library_values "${use_ipp_library}" ipp_linking_method_index)
+  if(ipp_linking_method_index EQUAL -1)
+    message(FATAL_ERROR "Unsupported IPP linking method: \"${use_ipp_library}\"")
+  endif()
+  list(GET ipp_compile_definitions ${ipp_linking_method_index} ipp_compile_definition)
+
+  set(${out_var} "${ipp_compile_definition}" PARENT_SCOPE)
+
+endfunction()
+
+
 function(_FRUT_get_recommended_compiler_warning_flags kind out_var)
 
   if(kind STREQUAL "LLVM")
@@ -5240,10 +6165,58 @@ function(_FRUT_get_recommended_compiler_warning_flags kind out_var)
 endfunction()
 
 
+function(_FRUT_get_SDK_header_search_paths out_var)
+
+  set(search_paths "")
+
+  if(JUCER_BUILD_VST OR JUCER_FLAG_JUCE_PLUGINHOST_VST)
+    if(DEFINED JUCER_VST_LEGACY_SDK_FOLDER)
+      list(APPEND search_paths "${JUCER_VST_LEGACY_SDK_FOLDER}")
+    endif()
+    if(DEFINED JUCER_VST_SDK_FOLDER)
+      list(APPEND search_paths "${JUCER_VST_SDK_FOLDER}")
+    endif()
+  endif()
+
+  if(JUCER_BUILD_VST3 OR JUCER_FLAG_JUCE_PLUGINHOST_VST3)
+    _FRUT_get_VST3_SDK_folder(vst3_sdk_folder)
+    if(DEFINED vst3_sdk_folder)
+      list(APPEND search_paths "${vst3_sdk_folder}")
+    endif()
+  endif()
+
+  if(JUCER_BUILD_AAX AND DEFINED JUCER_AAX_SDK_FOLDER)
+    list(APPEND search_paths
+      "${JUCER_AAX_SDK_FOLDER}"
+      "${JUCER_AAX_SDK_FOLDER}/Interfaces"
+      "${JUCER_AAX_SDK_FOLDER}/Interfaces/ACF"
+    )
+  endif()
+
+  set(${out_var} "${search_paths}" PARENT_SCOPE)
+
+endfunction()
+
+
+function(_FRUT_get_VST3_SDK_folder out_var)
+
+  string(CONCAT juce_internal_vst3_sdk_path
+    "${JUCER_PROJECT_MODULE_juce_audio_processors_PATH}/"
+    "juce_audio_processors/format_types/VST3_SDK"
+  )
+  if(DEFINED JUCER_VST3_SDK_FOLDER)
+    set(${out_var} "${JUCER_VST3_SDK_FOLDER}" PARENT_SCOPE)
+  elseif(EXISTS "${juce_internal_vst3_sdk_path}")
+    set(${out_var} "${juce_internal_vst3_sdk_path}" PARENT_SCOPE)
+  endif()
+
+endfunction()
+
+
 function(_FRUT_install_to_plugin_binary_location target plugin_type default_destination)
 
   if(ARGC GREATER 3)
-    if(NOT ARGV3 STREQUAL "FILES")
+    if(NOT ARGV3 STREQUAL "FILES" AND NOT ARGV3 STREQUAL "DIRECTORY")
       message(FATAL_ERROR "Unexpected argument \"${ARGV3}\"")
     endif()
   endif()
@@ -5262,9 +6235,23 @@ function(_FRUT_install_to_plugin_binary_location target plugin_type default_dest
       if((NOT DEFINED JUCER_ENABLE_PLUGIN_COPY_STEP_${config}
             AND (APPLE OR CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux"))
           OR JUCER_ENABLE_PLUGIN_COPY_STEP_${config})
-        install(TARGETS ${target} CONFIGURATIONS "${config}"
-          COMPONENT "${component}" DESTINATION "${destination}"
-        )
+        if(ARGV3 STREQUAL "DIRECTORY")
+          # Installs the bundle directory that the target is built into
+          string(TOUPPER "${config}" upper_config)
+          get_target_property(
+            output_directory ${target} LIBRARY_OUTPUT_DIRECTORY_${upper_config}
+          )
+          get_filename_component(output_directory "${output_directory}" ABSOLUTE
+            BASE_DIR "${CMAKE_CURRENT_BINARY_DIR}"
+          )
+          install(DIRECTORY "${output_directory}" CONFIGURATIONS "${config}"
+            COMPONENT "${component}" DESTINATION "${destination}"
+          )
+        else()
+          install(TARGETS ${target} CONFIGURATIONS "${config}"
+            COMPONENT "${component}" DESTINATION "${destination}"
+          )
+        endif()
         if(ARGV3 STREQUAL "FILES")
           install(${ARGN} CONFIGURATIONS "${config}"
             COMPONENT "${component}" DESTINATION "${destination}"
@@ -5276,18 +6263,54 @@ function(_FRUT_install_to_plugin_binary_location target plugin_type default_dest
   endforeach()
 
   if(should_install)
-    add_custom_command(TARGET ${target} POST_BUILD
-      COMMAND
-      "${CMAKE_COMMAND}"
-      "-DCMAKE_INSTALL_CONFIG_NAME=$<CONFIG>"
-      "-DCMAKE_INSTALL_COMPONENT=${component}"
-      "-P" "${CMAKE_CURRENT_BINARY_DIR}/cmake_install.cmake"
-    )
+    _FRUT_add_plugin_copy_step(${target} "${component}")
   endif()
 
 endfunction()
 
 
+function(_FRUT_link_header_search_paths folder search_paths)
+
+  # Merges the search paths into a single folder of symbolic links. An entry that only
+  # one search path provides is linked as is, while a folder that several search paths
+  # provide is created and filled recursively, so that "#include <a/b.h>" still finds
+  # the same header as with the separate search paths.
+  file(MAKE_DIRECTORY "${folder}")
+
+  set(names "")
+  foreach(path IN LISTS search_paths)
+    file(GLOB entries LIST_DIRECTORIES TRUE RELATIVE "${path}" "${path}/*")
+    foreach(name IN LISTS entries)
+      if(NOT name IN_LIST names)
+        list(APPEND names "${name}")
+        set(providers_${name} "")
+      endif()
+      list(APPEND providers_${name} "${path}/${name}")
+    endforeach()
+  endforeach()
+
+  foreach(name IN LISTS names)
+    list(GET providers_${name} 0 first_provider)
+    set(sub_search_paths "")
+    if(IS_DIRECTORY "${first_provider}")
+      foreach(provider IN LISTS providers_${name})
+        if(IS_DIRECTORY "${provider}")
+          list(APPEND sub_search_paths "${provider}")
+        endif()
+      endforeach()
+    endif()
+
+    list(LENGTH sub_search_paths sub_search_paths_count)
+    if(sub_search_paths_count GREATER 1)
+      _FRUT_link_header_search_paths("${folder}/${name}" "${sub_search_paths}")
+    else()
+      file(CREATE_LINK "${first_provider}" "${folder}/${name}" SYMBOLIC)
+    endif()
+  endforeach()
+
+endfunction()
+
+
 function(_FRUT_link_xcode_frameworks target exporter)
 
   if(NOT APPLE)
@@ -5436,6 +6459,29 @@ function(_FRUT_parse_arguments single_value_keywords multi_value_keywords argume
 endfunction()
 
 
+function(_FRUT_precompile_JuceHeader_header target)
+
+  set(has_cxx_sources FALSE)
+  get_target_property(sources ${target} SOURCES)
+  foreach(src_file IN LISTS sources)
+    get_source_file_property(skip_pch "${src_file}" SKIP_PRECOMPILE_HEADERS)
+    get_source_file_property(header_file_only "${src_file}" HEADER_FILE_ONLY)
+    if(src_file MATCHES "\\.(cpp|cc|cxx|mm)$" AND NOT skip_pch AND NOT header_file_only)
+      set(has_cxx_sources TRUE)
+    endif()
+  endforeach()
+  if(NOT has_cxx_sources)
+    return()
+  endif()
+
+  set(juce_header "${CMAKE_CURRENT_BINARY_DIR}/JuceLibraryCode/JuceHeader.h")
+  target_precompile_headers(${target} PRIVATE
+    "$<$<COMPILE_LANGUAGE:CXX>:${juce_header}>"
+  )
+
+endfunction()
+
+
 function(_FRUT_sanitize_path_in_user_folder out_path in_path)
 
   file(TO_CMAKE_PATH "$ENV{HOME}" user_folder)
@@ -5540,56 +6586,45 @@ endfunction()
 
 function(_FRUT_set_compiler_and_linker_settings target target_type exporter)
 
-  target_include_directories(${target} PRIVATE
-    "${CMAKE_CURRENT_BINARY_DIR}/JuceLibraryCode"
-    ${JUCER_PROJECT_MODULES_FOLDERS}
-    ${JUCER_PROJECT_MODULES_INTERNAL_SEARCH_PATHS}
-  )
-  foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+  if(DEFINED JUCER_CONSOLIDATED_HEADER_SEARCH_PATHS)
+    target_include_directories(${target} PRIVATE
+      ${JUCER_CONSOLIDATED_HEADER_SEARCH_PATHS}
+    )
+  elseif(JUCER_CONSOLIDATE_HEADER_SEARCH_PATHS)
+    foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+      set(search_paths "${JUCER_CONSOLIDATED_HEADER_SEARCH_PATHS_${config}}")
+      target_include_directories(${target} PRIVATE
+        $<$<CONFIG:${config}>:${search_paths}>
+      )
+    endforeach()
+  else()
+    target_include_directories(${target} PRIVATE
+      "${CMAKE_CURRENT_BINARY_DIR}/JuceLibraryCode"
+      ${JUCER_PROJECT_MODULES_FOLDERS}
+      ${JUCER_PROJECT_MODULES_INTERNAL_SEARCH_PATHS}
+    )
+    foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+      set(search_paths "")
+      foreach(path IN LISTS JUCER_HEADER_SEARCH_PATHS_${config})
+        file(TO_CMAKE_PATH "${path}" path)
+        _FRUT_abs_path_based_on_jucer_target_project_folder(path "${path}" "${exporter}")
+        list(APPEND search_paths "${path}")
+      endforeach()
+      target_include_directories(${target} PRIVATE
+        $<$<CONFIG:${config}>:${search_paths}>
+      )
+    endforeach()
+
     set(search_paths "")
-    foreach(path IN LISTS JUCER_HEADER_SEARCH_PATHS_${config})
+    foreach(path IN LISTS JUCER_HEADER_SEARCH_PATHS)
       file(TO_CMAKE_PATH "${path}" path)
       _FRUT_abs_path_based_on_jucer_target_project_folder(path "${path}" "${exporter}")
       list(APPEND search_paths "${path}")
     endforeach()
-    target_include_directories(${target} PRIVATE $<$<CONFIG:${config}>:${search_paths}>)
-  endforeach()
-
-  set(search_paths "")
-  foreach(path IN LISTS JUCER_HEADER_SEARCH_PATHS)
-    file(TO_CMAKE_PATH "${path}" path)
-    _FRUT_abs_path_based_on_jucer_target_project_folder(path "${path}" "${exporter}")
-    list(APPEND search_paths "${path}")
-  endforeach()
-  target_include_directories(${target} PRIVATE ${search_paths})
-
-  if(JUCER_BUILD_VST OR JUCER_FLAG_JUCE_PLUGINHOST_VST)
-    if(DEFINED JUCER_VST_LEGACY_SDK_FOLDER)
-      target_include_directories(${target} PRIVATE "${JUCER_VST_LEGACY_SDK_FOLDER}")
-    endif()
-    if(DEFINED JUCER_VST_SDK_FOLDER)
-      target_include_directories(${target} PRIVATE "${JUCER_VST_SDK_FOLDER}")
-    endif()
-  endif()
-
-  if(JUCER_BUILD_VST3 OR JUCER_FLAG_JUCE_PLUGINHOST_VST3)
-    string(CONCAT juce_internal_vst3_sdk_path
-      "${JUCER_PROJECT_MODULE_juce_audio_processors_PATH}/"
-      "juce_audio_processors/format_types/VST3_SDK"
-    )
-    if(DEFINED JUCER_VST3_SDK_FOLDER)
-      target_include_directories(${target} PRIVATE "${JUCER_VST3_SDK_FOLDER}")
-    elseif(EXISTS "${juce_internal_vst3_sdk_path}")
-      target_include_directories(${target} PRIVATE "${juce_internal_vst3_sdk_path}")
-    endif()
-  endif()
+    target_include_directories(${target} PRIVATE ${search_paths})
 
-  if(JUCER_BUILD_AAX AND DEFINED JUCER_AAX_SDK_FOLDER)
-    target_include_directories(${target} PRIVATE
-      "${JUCER_AAX_SDK_FOLDER}"
-      "${JUCER_AAX_SDK_FOLDER}/Interfaces"
-      "${JUCER_AAX_SDK_FOLDER}/Interfaces/ACF"
-    )
+    _FRUT_get_SDK_header_search_paths(sdk_search_paths)
+    target_include_directories(${target} PRIVATE ${sdk_search_paths})
   endif()
 
   if(DEFINED JUCER_ADD_RECOMMENDED_COMPILER_WARNING_FLAGS)
@@ -5617,7 +6652,10 @@ function(_FRUT_set_compiler_and_linker_settings target target_type exporter)
     endif()
     _FRUT_set_compiler_and_linker_settings_MSVC(${target})
   elseif(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
-    _FRUT_set_compiler_and_linker_settings_Linux(${target})
+    if(DEFINED JUCER_USE_IPP_LIBRARY OR DEFINED JUCER_USE_IPP_LIBRARY_ONE_API)
+      _FRUT_set_IPP_Linux_compiler_and_linker_settings(${target})
+    endif()
+    _FRUT_set_compiler_and_linker_settings_Linux(${target} "${target_type}")
   elseif(WIN32 AND NOT MSVC)
     _FRUT_set_compiler_and_linker_settings_MinGW(${target})
   endif()
@@ -5635,6 +6673,9 @@ function(_FRUT_set_compiler_and_linker_settings target target_type exporter)
     _FRUT_set_AppConfig_compile_definitions(${target})
   elseif(JUCER_PROJECT_TYPE STREQUAL "Audio Plug-in")
     _FRUT_set_JucePlugin_Build_defines(${target} ${target_type})
+    if(JUCER_LINK_TIME_PROJECT_VERSION)
+      _FRUT_set_JucePlugin_Version_defines(${target} ${target_type})
+    endif()
   endif()
 
   target_compile_options(${target} PRIVATE ${JUCER_EXTRA_COMPILER_FLAGS})
@@ -5947,29 +6988,35 @@ function(_FRUT_set_compiler_and_linker_settings_APPLE target)
       endif()
     endforeach()
   else()
-    set(macos_deployment_target "10.11")
-    if(DEFINED JUCER_MACOS_DEPLOYMENT_TARGET_${CMAKE_BUILD_TYPE})
-      set(macos_deployment_target "${JUCER_MACOS_DEPLOYMENT_TARGET_${CMAKE_BUILD_TYPE}}")
-    endif()
-    if(target MATCHES "_AUv3_AppExtension$"
-        AND macos_deployment_target VERSION_LESS 10.11)
-      set(macos_deployment_target "10.11")
-      message(STATUS "Set macOS Deployment Target to 10.11 for ${target}")
-    endif()
-    target_compile_options(${target} PRIVATE
-      "-mmacosx-version-min=${macos_deployment_target}"
-    )
-    set_property(TARGET ${target} APPEND_STRING PROPERTY
-      LINK_FLAGS " -mmacosx-version-min=${macos_deployment_target}"
-    )
+    foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
+      string(TOUPPER "${config}" upper_config)
 
-    set(sysroot "${JUCER_MACOSX_SDK_PATH_${CMAKE_BUILD_TYPE}}")
-    if(IS_DIRECTORY "${sysroot}")
-      target_compile_options(${target} PRIVATE -isysroot "${sysroot}")
+      set(macos_deployment_target "10.11")
+      if(DEFINED JUCER_MACOS_DEPLOYMENT_TARGET_${config})
+        set(macos_deployment_target "${JUCER_MACOS_DEPLOYMENT_TARGET_${config}}")
+      endif()
+      if(target MATCHES "_AUv3_AppExtension$"
+          AND macos_deployment_target VERSION_LESS 10.11)
+        set(macos_deployment_target "10.11")
+        message(STATUS "Set macOS Deployment Target to 10.11 for ${target} in ${config}")
+      endif()
+      target_compile_options(${target} PRIVATE
+        $<$<CONFIG:${config}>:-mmacosx-version-min=${macos_deployment_target}>
+      )
       set_property(TARGET ${target} APPEND_STRING PROPERTY
-        LINK_FLAGS " -isysroot ${sysroot}"
+        LINK_FLAGS_${upper_config} " -mmacosx-version-min=${macos_deployment_target}"
       )
-    endif()
+
+      set(sysroot "${JUCER_MACOSX_SDK_PATH_${config}}")
+      if(IS_DIRECTORY "${sysroot}")
+        target_compile_options(${target} PRIVATE
+          "$<$<CONFIG:${config}>:-isysroot;${sysroot}>"
+        )
+        set_property(TARGET ${target} APPEND_STRING PROPERTY
+          LINK_FLAGS_${upper_config} " -isysroot ${sysroot}"
+        )
+      endif()
+    endforeach()
   endif()
 
   set(development_team_id_string "${JUCER_DEVELOPMENT_TEAM_ID}")
@@ -6105,7 +7152,7 @@ function(_FRUT_set_compiler_and_linker_settings_APPLE target)
 endfunction()
 
 
-function(_FRUT_set_compiler_and_linker_settings_Linux target)
+function(_FRUT_set_compiler_and_linker_settings_Linux target target_type)
 
   target_compile_definitions(${target} PRIVATE "LINUX=1")
 
@@ -6145,13 +7192,28 @@ function(_FRUT_set_compiler_and_linker_settings_Linux target)
     set_property(TARGET ${target} APPEND_STRING PROPERTY
       LINK_FLAGS_${upper_config} " ${architecture_flag}"
     )
+
+    if(JUCER_SPLIT_DEBUG_INFO_${config})
+      target_compile_options(${target} PRIVATE $<$<CONFIG:${config}>:-g>)
+      set_property(TARGET ${target} APPEND_STRING PROPERTY
+        LINK_FLAGS_${upper_config} " -Wl,--build-id"
+      )
+    endif()
   endforeach()
 
+  # See MakefileProjectExporter::getCompilePackages() and getLinkPackages()
+  # in JUCE/extras/Projucer/Source/ProjectSaving/jucer_ProjectExport_Make.h
   set(linux_packages ${JUCER_PROJECT_LINUX_PACKAGES} ${JUCER_PKGCONFIG_LIBRARIES})
+  set(compile_only_packages "")
   if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 5.0.0)
       AND "juce_gui_extra" IN_LIST JUCER_PROJECT_MODULES
       AND (NOT DEFINED JUCER_FLAG_JUCE_WEB_BROWSER OR JUCER_FLAG_JUCE_WEB_BROWSER))
     list(APPEND linux_packages "webkit2gtk-4.0" "gtk+-x11-3.0")
+    # Since JUCE 6, WebBrowserComponent loads WebKit and GTK with dlopen() when it is
+    # first used
+    if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 6.0.0))
+      list(APPEND compile_only_packages "webkit2gtk-4.0" "gtk+-x11-3.0")
+    endif()
   endif()
   if((NOT DEFINED JUCER_VERSION OR JUCER_VERSION VERSION_GREATER 5.3.2)
       AND "juce_core" IN_LIST JUCER_PROJECT_MODULES
@@ -6159,6 +7221,39 @@ function(_FRUT_set_compiler_and_linker_settings_Linux target)
       AND NOT JUCER_FLAG_JUCE_LOAD_CURL_SYMBOLS_LAZILY)
     list(APPEND linux_packages "libcurl")
   endif()
+  # juce_dsp declares the single-precision FFTW functions that it uses, so
+  # JUCE_DSP_USE_STATIC_FFTW only requires linking fftw3f. With JUCE_DSP_USE_SHARED_FFTW,
+  # libfftw3f.so is loaded with dlopen() when the first FFT is created.
+  if("juce_dsp" IN_LIST JUCER_PROJECT_MODULES AND JUCER_FLAG_JUCE_DSP_USE_STATIC_FFTW)
+    list(APPEND linux_packages "fftw3f")
+  endif()
+
+  # The Shared Code target of Audio Plug-in projects is a static library, so it doesn't
+  # need to link anything. The plugin format targets link the packages and libraries
+  # themselves, minus the ones listed in <format>_UNLINKED_PACKAGES.
+  get_target_property(target_kind ${target} TYPE)
+  set(unlinked_packages "")
+  if(target_type STREQUAL "SharedCodeTarget" AND target_kind STREQUAL "STATIC_LIBRARY")
+    set(unlinked_packages ${linux_packages} ${JUCER_PROJECT_LINUX_LIBS})
+  elseif(target_type STREQUAL "VSTPlugIn")
+    set(unlinked_packages ${JUCER_VST_UNLINKED_PACKAGES})
+  elseif(target_type STREQUAL "VST3PlugIn")
+    set(unlinked_packages ${JUCER_VST3_UNLINKED_PACKAGES})
+  elseif(target_type STREQUAL "StandalonePlugIn")
+    set(unlinked_packages ${JUCER_STANDALONE_UNLINKED_PACKAGES})
+  elseif(target_type STREQUAL "UnityPlugIn")
+    set(unlinked_packages ${JUCER_UNITY_UNLINKED_PACKAGES})
+  elseif(target_type STREQUAL "LV2PlugIn")
+    set(unlinked_packages ${JUCER_LV2_UNLINKED_PACKAGES})
+  endif()
+
+  if(JUCER_LINK_AS_NEEDED
+      AND (target_kind STREQUAL "EXECUTABLE"
+        OR target_kind STREQUAL "SHARED_LIBRARY"
+        OR target_kind STREQUAL "MODULE_LIBRARY"))
+    set_property(TARGET ${target} APPEND_STRING PROPERTY LINK_FLAGS " -Wl,--as-needed")
+  endif()
+
   if(linux_packages)
     find_package(PkgConfig REQUIRED)
     list(REMOVE_DUPLICATES linux_packages)
@@ -6169,7 +7264,9 @@ function(_FRUT_set_compiler_and_linker_settings_Linux target)
         string(APPEND missing_packages " ${pkg}")
       endif()
       target_compile_options(${target} PRIVATE ${${pkg}_CFLAGS})
-      target_link_libraries(${target} PRIVATE ${${pkg}_LIBRARIES})
+      if(NOT pkg IN_LIST compile_only_packages AND NOT pkg IN_LIST unlinked_packages)
+        target_link_libraries(${target} PRIVATE ${${pkg}_LIBRARIES})
+      endif()
     endforeach()
     if(DEFINED missing_packages)
       message(FATAL_ERROR "pkg-config could not find the following packages:"
@@ -6189,7 +7286,9 @@ function(_FRUT_set_compiler_and_linker_settings_Linux target)
     if(linux_lib STREQUAL "pthread")
       target_compile_options(${target} PRIVATE "-pthread")
     endif()
-    target_link_libraries(${target} PRIVATE "-l${linux_lib}")
+    if(NOT linux_lib IN_LIST unlinked_packages)
+      target_link_libraries(${target} PRIVATE "-l${linux_lib}")
+    endif()
   endforeach()
 
   if(JUCER_PROJECT_TYPE STREQUAL "Audio Plug-in"
@@ -6500,7 +7599,14 @@ function(_FRUT_set_cxx_language_standard_properties target)
         set_target_properties(${target} PROPERTIES CXX_EXTENSIONS OFF)
         set_target_properties(${target} PROPERTIES CXX_STANDARD 11)
 
-        set(cxx_language_standard "${JUCER_CXX_LANGUAGE_STANDARD_${CMAKE_BUILD_TYPE}}")
+        # CXX_STANDARD can't differ between configurations, so multi-config generators
+        # use the C++ language standard of the first configuration
+        if(DEFINED CMAKE_CONFIGURATION_TYPES)
+          list(GET JUCER_PROJECT_CONFIGURATIONS 0 config)
+        else()
+          set(config "${CMAKE_BUILD_TYPE}")
+        endif()
+        set(cxx_language_standard "${JUCER_CXX_LANGUAGE_STANDARD_${config}}")
         if(cxx_language_standard)
           if(cxx_language_standard MATCHES "^GNU\\+\\+")
             set_target_properties(${target} PROPERTIES CXX_EXTENSIONS ON)
@@ -6544,6 +7650,88 @@ function(_FRUT_set_cxx_language_standard_properties target)
 endfunction()
 
 
+function(_FRUT_set_IPP_Linux_compiler_and_linker_settings target)
+
+  find_path(JUCER_IPP_ROOT
+    NAMES "include/ipp.h"
+    HINTS
+      "$ENV{IPPROOT}"
+      "/opt/intel/oneapi/ipp/latest"
+      "/opt/intel/ipp"
+  )
+  if(NOT JUCER_IPP_ROOT OR NOT IS_DIRECTORY "${JUCER_IPP_ROOT}")
+    message(FATAL_ERROR "Could not find Intel IPP. Please set JUCER_IPP_ROOT to the"
+      " Intel IPP root directory (the one containing include/ipp.h), or source the"
+      " environment script of Intel IPP so that IPPROOT is defined."
+    )
+  endif()
+
+  if(CMAKE_SIZEOF_VOID_P EQUAL 8) # 64-bit
+    set(ipp_arch "intel64")
+    set(ipp_arch_lib_dir "lib")
+  else()
+    set(ipp_arch "ia32")
+    set(ipp_arch_lib_dir "lib32")
+  endif()
+
+  # Intel IPP 2021 and older put the libraries in lib/<arch>, newer versions in lib or
+  # lib32
+  if(IS_DIRECTORY "${JUCER_IPP_ROOT}/lib/${ipp_arch}")
+    set(ipp_lib_dir "${JUCER_IPP_ROOT}/lib/${ipp_arch}")
+  else()
+    set(ipp_lib_dir "${JUCER_IPP_ROOT}/${ipp_arch_lib_dir}")
+  endif()
+
+  _FRUT_get_IPP_compile_definition(ipp_compile_definition)
+  target_compile_definitions(${target} PRIVATE "${ipp_compile_definition}")
+
+  target_include_directories(${target} PRIVATE "${JUCER_IPP_ROOT}/include")
+
+  if(ipp_compile_definition MATCHES "^_IPP_PARALLEL_")
+    if(NOT IS_DIRECTORY "${ipp_lib_dir}/threaded")
+      message(FATAL_ERROR "Could not find the multi-threaded libraries of Intel IPP in"
+        " \"${ipp_lib_dir}/threaded\". They are not provided by Intel IPP 2021 and newer,"
+        " please use a single-threaded linking method instead."
+      )
+    endif()
+    set(ipp_lib_dir "${ipp_lib_dir}/threaded")
+  endif()
+
+  if(ipp_compile_definition MATCHES "_STATIC$")
+    set(ipp_lib_suffix "${CMAKE_STATIC_LIBRARY_SUFFIX}")
+  else()
+    set(ipp_lib_suffix "${CMAKE_SHARED_LIBRARY_SUFFIX}")
+  endif()
+
+  # Signal processing, vector math and core, in dependency order
+  foreach(ipp_domain IN ITEMS "s" "vm" "core")
+    set(ipp_lib "${ipp_lib_dir}/libipp${ipp_domain}${ipp_lib_suffix}")
+    if(NOT EXISTS "${ipp_lib}")
+      message(FATAL_ERROR "Could not find the Intel IPP library \"${ipp_lib}\"")
+    endif()
+    target_link_libraries(${target} PRIVATE "${ipp_lib}")
+  endforeach()
+
+  if(ipp_compile_definition MATCHES "^_IPP_PARALLEL_")
+    find_library(JUCER_IPP_OPENMP_LIBRARY
+      NAMES "iomp5"
+      HINTS
+        "${JUCER_IPP_ROOT}/../compiler/lib/${ipp_arch}"
+        "${JUCER_IPP_ROOT}/../compiler/lib/${ipp_arch}_lin"
+        "${JUCER_IPP_ROOT}/../lib/${ipp_arch}"
+    )
+    if(NOT JUCER_IPP_OPENMP_LIBRARY)
+      message(FATAL_ERROR "Could not find the Intel OpenMP library (libiomp5) required"
+        " by the multi-threaded libraries of Intel IPP. Please set"
+        " JUCER_IPP_OPENMP_LIBRARY to its path."
+      )
+    endif()
+    target_link_libraries(${target} PRIVATE "${JUCER_IPP_OPENMP_LIBRARY}" "pthread")
+  endif()
+
+endfunction()
+
+
 function(_FRUT_set_IPP_windows_compiler_and_linker_settings target)
 
   set(ipp_registry_base_path "HKEY_LOCAL_MACHINE\\SOFTWARE\\WOW6432Node\\Intel\\Suites")
@@ -6576,29 +7764,7 @@ function(_FRUT_set_IPP_windows_compiler_and_linker_settings target)
     )
   endif()
 
-  set(use_ipp_library_values
-    "Yes (Default Mode)"
-    "Yes (Default Linking)"
-    "Multi-Threaded Static Library"
-    "Single-Threaded Static Library"
-    "Multi-Threaded DLL"
-    "Single-Threaded DLL"
-  )
-  list(FIND use_ipp_library_values "${JUCER_USE_IPP_LIBRARY}" ipp_linking_method_index)
-  if(ipp_linking_method_index EQUAL -1)
-    message(FATAL_ERROR
-      "Unsupported value for JUCER_USE_IPP_LIBRARY: \"${JUCER_USE_IPP_LIBRARY}\""
-    )
-  endif()
-  set(ipp_compile_definitions
-    "_IPP_SEQUENTIAL_DYNAMIC"
-    "_IPP_SEQUENTIAL_DYNAMIC"
-    "_IPP_PARALLEL_STATIC"
-    "_IPP_SEQUENTIAL_STATIC"
-    "_IPP_PARALLEL_DYNAMIC"
-    "_IPP_SEQUENTIAL_DYNAMIC"
-  )
-  list(GET ipp_compile_definitions ${ipp_linking_method_index} ipp_compile_definition)
+  _FRUT_get_IPP_compile_definition(ipp_compile_definition)
   target_compile_definitions(${target} PRIVATE "${ipp_compile_definition}")
 
   target_include_directories(${target} PRIVATE "${JUCER_IPP_INSTALL_DIR}/ipp/include")
@@ -6630,13 +7796,26 @@ function(_FRUT_set_JucePlugin_Build_defines target target_type)
     set(range_max 7)
   endif()
 
+  if(NOT (DEFINED JUCER_VERSION AND JUCER_VERSION VERSION_LESS 7.0.0))
+    list(APPEND plugin_types LV2)
+    list(APPEND setting_suffixes LV2)
+    list(APPEND define_suffixes LV2)
+    set(range_max 8)
+  endif()
+
   foreach(index RANGE ${range_max})
     list(GET setting_suffixes ${index} setting_suffix)
     list(GET plugin_types ${index} plugin_type)
     list(GET define_suffixes ${index} define_suffix)
 
+    set(build_plugin_type "${JUCER_BUILD_${setting_suffix}}")
+    if(plugin_type STREQUAL "LV2" AND NOT CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+      # The LV2 target is only created on Linux
+      set(build_plugin_type OFF)
+    endif()
+
     if(target_type STREQUAL "${plugin_type}PlugIn"
-        OR (target_type STREQUAL "SharedCodeTarget" AND JUCER_BUILD_${setting_suffix}))
+        OR (target_type STREQUAL "SharedCodeTarget" AND build_plugin_type))
       target_compile_definitions(${target} PRIVATE "JucePlugin_Build_${define_suffix}=1")
     else()
       target_compile_definitions(${target} PRIVATE "JucePlugin_Build_${define_suffix}=0")
@@ -6646,6 +7825,22 @@ function(_FRUT_set_JucePlugin_Build_defines target target_type)
 endfunction()
 
 
+function(_FRUT_set_JucePlugin_Version_defines target target_type)
+
+  # The plugin wrappers need the version as compile-time constants. The other targets
+  # get it from ProjectVersion.cpp at link time, so that they aren't recompiled when
+  # the version changes.
+  if(target_type MATCHES "PlugIn$")
+    target_compile_definitions(${target} PRIVATE
+      "JucePlugin_Version=${JUCER_PROJECT_VERSION}"
+      "JucePlugin_VersionCode=${JUCER_PROJECT_VERSION_AS_HEX}"
+      "JucePlugin_VersionString=\"${JUCER_PROJECT_VERSION}\""
+    )
+  endif()
+
+endfunction()
+
+
 function(_FRUT_set_output_directory_properties target subfolder)
 
   foreach(config IN LISTS JUCER_PROJECT_CONFIGURATIONS)
@@ -6660,6 +7855,10 @@ function(_FRUT_set_output_directory_properties target subfolder)
       endif()
     elseif(DEFINED JUCER_BINARY_LOCATION_${config})
       set(output_directory "${JUCER_BINARY_LOCATION_${config}}")
+    elseif(CMAKE_GENERATOR STREQUAL "Ninja Multi-Config")
+      # Same as the default output directory, but explicit so that the bundle directories
+      # of plugins are based on it and don't collide between configurations
+      set(output_directory "${CMAKE_CURRENT_BINARY_DIR}/${config}")
     endif()
     if(DEFINED output_directory)
       set_target_properties(${target} PROPERTIES
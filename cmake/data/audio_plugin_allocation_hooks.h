@@ -0,0 +1,217 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Allocation hooks shared by the harnesses that need to see every allocation.
+//
+// operator new and operator delete are replaced on all platforms. With glibc, malloc()
+// and friends are interposed as well, so that allocations made through the C API (e.g.
+// when juce::HeapBlock or juce::MemoryBlock grows) are seen too. Each hook calls
+// frut::harness::onAllocation() or frut::harness::onDeallocation(), which the harness
+// including this header must define, and which must not allocate.
+//
+// This header defines the replacement functions, so it must be included by a single
+// translation unit of the harness.
+
+#pragma once
+
+#include "audio_plugin_harness.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+#if JUCE_LINUX && defined(__GLIBC__)
+  #define FRUT_HOOK_LIBC 1
+#else
+  #define FRUT_HOOK_LIBC 0
+#endif
+
+
+namespace frut
+{
+namespace harness
+{
+
+void onAllocation(const char* function, std::size_t size) noexcept;
+void onDeallocation(const char* function) noexcept;
+
+} // namespace harness
+} // namespace frut
+
+
+#if FRUT_HOOK_LIBC
+
+extern "C" {
+
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void __libc_free(void*);
+
+void* malloc(size_t size) noexcept
+{
+  frut::harness::onAllocation("malloc", size);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept
+{
+  frut::harness::onAllocation("calloc", count * size);
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept
+{
+  frut::harness::onAllocation("realloc", size);
+  return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) noexcept
+{
+  frut::harness::onAllocation("memalign", size);
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept
+{
+  frut::harness::onAllocation("aligned_alloc", size);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) noexcept
+{
+  frut::harness::onAllocation("posix_memalign", size);
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+  {
+    return EINVAL;
+  }
+  *ptr = __libc_memalign(alignment, size);
+  return *ptr == nullptr && size != 0 ? ENOMEM : 0;
+}
+
+void free(void* ptr) noexcept
+{
+  if (ptr != nullptr)
+  {
+    frut::harness::onDeallocation("free");
+  }
+  __libc_free(ptr);
+}
+
+} // extern "C"
+
+#endif // FRUT_HOOK_LIBC
+
+
+namespace frut
+{
+namespace harness
+{
+namespace detail
+{
+
+inline void* allocate(std::size_t size)
+{
+  onAllocation("operator new", size);
+#if FRUT_HOOK_LIBC
+  auto* ptr = __libc_malloc(size == 0 ? 1 : size);
+#else
+  auto* ptr = std::malloc(size == 0 ? 1 : size);
+#endif
+  if (ptr == nullptr)
+  {
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+
+
+inline void deallocate(void* ptr) noexcept
+{
+  if (ptr != nullptr)
+  {
+    onDeallocation("operator delete");
+  }
+#if FRUT_HOOK_LIBC
+  __libc_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+} // namespace detail
+} // namespace harness
+} // namespace frut
+
+
+void* operator new(std::size_t size)
+{
+  return frut::harness::detail::allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return frut::harness::detail::allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  try
+  {
+    return frut::harness::detail::allocate(size);
+  }
+  catch (const std::bad_alloc&)
+  {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  frut::harness::detail::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  frut::harness::detail::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  frut::harness::detail::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  frut::harness::detail::deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  frut::harness::detail::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  frut::harness::detail::deallocate(ptr);
+}
@@ -0,0 +1,361 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_Benchmark: times processBlock() over synthetic audio and MIDI for every
+// combination of sample rate, block size and channel layout, and prints a JSON report.
+//
+// With --denormals, it instead feeds a short noise burst followed by silence, so that
+// filters, reverbs and envelopes decay into the subnormal range. This decaying tail is
+// processed with flush-to-zero/denormals-are-zero enabled, then disabled, and every block
+// whose cost differs sharply between the two modes is reported. Blocks producing
+// subnormal output samples or raising the floating-point underflow flag are reported as
+// well.
+//
+// usage: <target>_Benchmark [--sample-rates 44100,48000,96000]
+//                           [--block-sizes 32,64,128,256,512,1024]
+//                           [--channels <ins>-<outs>[,<ins>-<outs>...]]
+//                           [--seconds <audio-seconds-per-run>]
+//                           [--warmup-blocks <count>]
+//                           [--output <json-file>]
+//
+//        <target>_Benchmark --denormals
+//                           [--sample-rate 48000]
+//                           [--block-size 512]
+//                           [--channels <ins>-<outs>]
+//                           [--seconds <audio-seconds-per-run>]
+//                           [--repetitions <count>]
+//                           [--threshold <slowdown-ratio>]
+//                           [--output <json-file>]
+
+#include "audio_plugin_harness.h"
+
+#include <cfenv>
+#include <cmath>
+
+
+namespace
+{
+
+juce::var runBenchmark(double sampleRate, int blockSize,
+                       const frut::harness::ChannelLayout& channelLayout,
+                       double seconds, int warmupBlocks)
+{
+  using namespace frut::harness;
+
+  auto result = makeObject();
+  setProperty(result, "sample_rate", sampleRate);
+  setProperty(result, "block_size", blockSize);
+  setProperty(result, "channels", channelLayout.toString());
+
+  auto processor = createProcessor();
+  if (!applyChannelLayout(*processor, channelLayout))
+  {
+    setProperty(result, "skipped", "unsupported channel layout");
+    return result;
+  }
+
+  processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+  processor->prepareToPlay(sampleRate, blockSize);
+
+  const auto numChannels = std::max(processor->getTotalNumInputChannels(),
+                                     processor->getTotalNumOutputChannels());
+  juce::AudioBuffer<float> buffer{numChannels, blockSize};
+  juce::MidiBuffer midi;
+  juce::Random random{0x46525554};
+  const auto acceptsMidi = processor->acceptsMidi();
+
+  const auto numBlocks =
+    std::max(1, static_cast<int>(seconds * sampleRate / double(blockSize)));
+  std::vector<double> blockNanoseconds;
+  blockNanoseconds.reserve(static_cast<std::size_t>(numBlocks));
+  std::int64_t totalNanoseconds = 0;
+
+  for (auto blockIndex = -warmupBlocks; blockIndex < numBlocks; ++blockIndex)
+  {
+    fillWithNoise(buffer, random);
+    if (acceptsMidi)
+    {
+      fillWithNotes(midi, blockIndex + warmupBlocks, blockSize);
+    }
+    else
+    {
+      midi.clear();
+    }
+
+    const auto start = Clock::now();
+    processor->processBlock(buffer, midi);
+    const auto elapsed = nanosecondsSince(start);
+
+    if (blockIndex >= 0)
+    {
+      blockNanoseconds.push_back(double(elapsed));
+      totalNanoseconds += elapsed;
+    }
+  }
+
+  processor->releaseResources();
+
+  const auto numSamples = double(numBlocks) * double(blockSize);
+  const auto realTimeNanoseconds = numSamples / sampleRate * 1.0e9;
+
+  setProperty(result, "blocks", numBlocks);
+  setProperty(result, "ns_per_sample", double(totalNanoseconds) / numSamples);
+  setProperty(result, "cpu_load", double(totalNanoseconds) / realTimeNanoseconds);
+
+  const auto maxBlockNanoseconds =
+    blockNanoseconds.empty()
+      ? 0.0
+      : *std::max_element(blockNanoseconds.begin(), blockNanoseconds.end());
+
+  auto blockTimes = makeObject();
+  setProperty(blockTimes, "p50", percentile(blockNanoseconds, 0.50));
+  setProperty(blockTimes, "p90", percentile(blockNanoseconds, 0.90));
+  setProperty(blockTimes, "p99", percentile(blockNanoseconds, 0.99));
+  setProperty(blockTimes, "max", maxBlockNanoseconds);
+  setProperty(result, "block_ns", blockTimes);
+
+  return result;
+}
+
+
+struct DecayingTailRun
+{
+  std::vector<double> blockNanoseconds;
+  std::vector<int> numSubnormalSamples;
+  std::vector<bool> raisedUnderflow;
+};
+
+
+// Processes a noise burst followed by silence, with flush-to-zero and
+// denormals-are-zero enabled or disabled on the calling thread. Plugins that use
+// juce::ScopedNoDenormals in processBlock() override this setting, as they should.
+DecayingTailRun processDecayingTail(juce::AudioProcessor& processor, int numBlocks,
+                                    int blockSize, bool flushDenormals)
+{
+  using namespace frut::harness;
+
+  juce::FloatVectorOperations::disableDenormalisedNumberSupport(flushDenormals);
+
+  const auto numChannels = std::max(processor.getTotalNumInputChannels(),
+                                    processor.getTotalNumOutputChannels());
+  juce::AudioBuffer<float> buffer{numChannels, blockSize};
+  juce::MidiBuffer midi;
+  juce::Random random{0x46525554};
+  const auto numBurstBlocks = std::max(1, numBlocks / 20);
+
+  DecayingTailRun run;
+  for (auto blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+  {
+    if (blockIndex < numBurstBlocks)
+    {
+      fillWithNoise(buffer, random);
+    }
+    else
+    {
+      buffer.clear();
+    }
+    if (processor.acceptsMidi() && blockIndex == 0)
+    {
+      fillWithNotes(midi, blockIndex, blockSize);
+    }
+    else
+    {
+      midi.clear();
+    }
+
+    std::feclearexcept(FE_UNDERFLOW);
+    const auto start = Clock::now();
+    processor.processBlock(buffer, midi);
+    const auto elapsed = nanosecondsSince(start);
+    const auto raisedUnderflow = std::fetestexcept(FE_UNDERFLOW) != 0;
+
+    auto numSubnormalSamples = 0;
+    for (auto channel = 0; channel < buffer.getNumChannels(); ++channel)
+    {
+      const auto* samples = buffer.getReadPointer(channel);
+      for (auto i = 0; i < blockSize; ++i)
+      {
+        if (std::fpclassify(samples[i]) == FP_SUBNORMAL)
+        {
+          ++numSubnormalSamples;
+        }
+      }
+    }
+
+    run.blockNanoseconds.push_back(double(elapsed));
+    run.numSubnormalSamples.push_back(numSubnormalSamples);
+    run.raisedUnderflow.push_back(raisedUnderflow);
+  }
+
+  juce::FloatVectorOperations::disableDenormalisedNumberSupport(false);
+  return run;
+}
+
+
+juce::var runDenormalCheck(const frut::harness::CommandLine& commandLine)
+{
+  using namespace frut::harness;
+
+  const auto sampleRate = commandLine.getValue("--sample-rate", "48000").getDoubleValue();
+  const auto blockSize =
+    std::max(1, commandLine.getValue("--block-size", "512").getIntValue());
+  const auto channelLayouts =
+    parseChannelLayouts(commandLine.getValue("--channels", "2-2"));
+  const auto channelLayout =
+    channelLayouts.empty() ? ChannelLayout{2, 2} : channelLayouts.front();
+  const auto seconds = commandLine.getValue("--seconds", "10").getDoubleValue();
+  const auto repetitions =
+    std::max(1, commandLine.getValue("--repetitions", "3").getIntValue());
+  const auto threshold = commandLine.getValue("--threshold", "2").getDoubleValue();
+  const auto numBlocks =
+    std::max(1, static_cast<int>(seconds * sampleRate / double(blockSize)));
+
+  auto result = makeObject();
+  setProperty(result, "sample_rate", sampleRate);
+  setProperty(result, "block_size", blockSize);
+  setProperty(result, "channels", channelLayout.toString());
+  setProperty(result, "blocks", numBlocks);
+
+  // The two modes are interleaved and the fastest time of each block is kept, so that
+  // a noisy machine doesn't make a block look slow in one mode only
+  std::vector<double> flushedNanoseconds(std::size_t(numBlocks), 0.0);
+  std::vector<double> denormalNanoseconds(std::size_t(numBlocks), 0.0);
+  DecayingTailRun denormalRun;
+
+  for (auto repetition = 0; repetition < repetitions; ++repetition)
+  {
+    for (const auto flushDenormals : {true, false})
+    {
+      auto processor = createProcessor();
+      if (!applyChannelLayout(*processor, channelLayout))
+      {
+        setProperty(result, "skipped", "unsupported channel layout");
+        return result;
+      }
+      processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+      processor->prepareToPlay(sampleRate, blockSize);
+      auto run = processDecayingTail(*processor, numBlocks, blockSize, flushDenormals);
+      processor->releaseResources();
+
+      auto& fastest = flushDenormals ? flushedNanoseconds : denormalNanoseconds;
+      for (std::size_t i = 0; i < fastest.size(); ++i)
+      {
+        if (repetition == 0 || run.blockNanoseconds[i] < fastest[i])
+        {
+          fastest[i] = run.blockNanoseconds[i];
+        }
+      }
+      if (!flushDenormals)
+      {
+        denormalRun = std::move(run);
+      }
+    }
+  }
+
+  auto flushedTotal = 0.0;
+  auto denormalTotal = 0.0;
+  auto numBlocksWithSubnormalOutput = 0;
+  auto numBlocksRaisingUnderflow = 0;
+  juce::var flaggedBlocks;
+
+  for (std::size_t i = 0; i < flushedNanoseconds.size(); ++i)
+  {
+    flushedTotal += flushedNanoseconds[i];
+    denormalTotal += denormalNanoseconds[i];
+    const auto numSubnormalSamples = denormalRun.numSubnormalSamples[i];
+    const bool raisedUnderflow = denormalRun.raisedUnderflow[i];
+    numBlocksWithSubnormalOutput += numSubnormalSamples > 0 ? 1 : 0;
+    numBlocksRaisingUnderflow += raisedUnderflow ? 1 : 0;
+
+    const auto ratio = denormalNanoseconds[i] / std::max(1.0, flushedNanoseconds[i]);
+    if (ratio >= threshold || ratio <= 1.0 / threshold)
+    {
+      auto block = makeObject();
+      setProperty(block, "index", int(i));
+      setProperty(block, "time_s", double(i) * double(blockSize) / sampleRate);
+      setProperty(block, "ftz_ns", flushedNanoseconds[i]);
+      setProperty(block, "no_ftz_ns", denormalNanoseconds[i]);
+      setProperty(block, "ratio", ratio);
+      setProperty(block, "subnormal_output_samples", numSubnormalSamples);
+      setProperty(block, "raised_underflow", raisedUnderflow);
+      flaggedBlocks.append(block);
+    }
+  }
+
+  setProperty(result, "ftz_total_ns", flushedTotal);
+  setProperty(result, "no_ftz_total_ns", denormalTotal);
+  setProperty(result, "ratio", denormalTotal / std::max(1.0, flushedTotal));
+  setProperty(result, "blocks_with_subnormal_output", numBlocksWithSubnormalOutput);
+  setProperty(result, "blocks_raising_underflow", numBlocksRaisingUnderflow);
+  setProperty(result, "threshold", threshold);
+  setProperty(result, "flagged_blocks", flaggedBlocks);
+  return result;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  if (commandLine.hasFlag("--denormals"))
+  {
+    auto report = makeObject();
+    setProperty(report, "plugin", JucePlugin_Name);
+    setProperty(report, "version", JucePlugin_VersionString);
+    setProperty(report, "denormals", runDenormalCheck(commandLine));
+    return writeReport(commandLine, report);
+  }
+
+  const auto sampleRates = commandLine.getIntList("--sample-rates", "44100,48000,96000");
+  const auto blockSizes =
+    commandLine.getIntList("--block-sizes", "32,64,128,256,512,1024");
+  const auto channelLayouts =
+    parseChannelLayouts(commandLine.getValue("--channels", "2-2"));
+  const auto seconds = commandLine.getValue("--seconds", "10").getDoubleValue();
+  const auto warmupBlocks =
+    std::max(0, commandLine.getValue("--warmup-blocks", "16").getIntValue());
+
+  auto report = makeObject();
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+  setProperty(report, "seconds_per_run", seconds);
+
+  juce::var runs;
+  for (const auto& channelLayout : channelLayouts)
+  {
+    for (const auto sampleRate : sampleRates)
+    {
+      for (const auto blockSize : blockSizes)
+      {
+        if (sampleRate > 0 && blockSize > 0)
+        {
+          runs.append(
+            runBenchmark(double(sampleRate), blockSize, channelLayout, seconds,
+                         warmupBlocks));
+        }
+      }
+    }
+  }
+  setProperty(report, "runs", runs);
+
+  return writeReport(commandLine, report);
+}
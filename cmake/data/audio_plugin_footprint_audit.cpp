@@ -0,0 +1,308 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_FootprintAudit: creates processor instances one after the other, like a host
+// loading a large session, and prints a JSON report with the resident set size, heap
+// and thread count growth caused by each instance: by its construction, by
+// prepareToPlay() at each sample rate and block size, and by creating its editor.
+//
+// The heap size comes from mallinfo() with glibc and from malloc_zone_statistics() on
+// macOS. JUCE doesn't provide a way to enumerate timers, but the first juce::Timer of the
+// process starts JUCE's timer thread, which shows up in the thread count.
+//
+// usage: <target>_FootprintAudit [--instances <count>]
+//                                [--sample-rates 44100,48000,96000]
+//                                [--block-sizes 64,512,2048]
+//                                [--no-editor]
+//                                [--output <json-file>]
+
+#include "audio_plugin_harness.h"
+
+#if JUCE_LINUX
+  #include <dirent.h>
+  #include <malloc.h>
+  #include <unistd.h>
+
+  #include <fstream>
+#elif JUCE_MAC
+  #include <mach/mach.h>
+  #include <malloc/malloc.h>
+#endif
+
+
+namespace
+{
+
+struct Footprint
+{
+  std::int64_t residentBytes = -1;
+  std::int64_t heapBytes = -1;
+  int numThreads = -1;
+};
+
+
+Footprint getFootprint()
+{
+  Footprint footprint;
+
+#if JUCE_LINUX
+  std::ifstream statm{"/proc/self/statm"};
+  std::int64_t totalPages = 0;
+  std::int64_t residentPages = 0;
+  if (statm >> totalPages >> residentPages)
+  {
+    footprint.residentBytes = residentPages * std::int64_t(sysconf(_SC_PAGESIZE));
+  }
+
+  #if defined(__GLIBC__)
+    #if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+  const auto info = mallinfo2();
+    #else
+  const auto info = mallinfo();
+    #endif
+  // Bytes in use in the malloc arenas, plus chunks allocated with mmap()
+  footprint.heapBytes = std::int64_t(info.uordblks) + std::int64_t(info.hblkhd);
+  #endif
+
+  if (auto* taskDir = opendir("/proc/self/task"))
+  {
+    footprint.numThreads = 0;
+    while (auto* entry = readdir(taskDir))
+    {
+      if (entry->d_name[0] != '.')
+      {
+        ++footprint.numThreads;
+      }
+    }
+    closedir(taskDir);
+  }
+#elif JUCE_MAC
+  mach_task_basic_info_data_t taskInfo;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&taskInfo), &count)
+      == KERN_SUCCESS)
+  {
+    footprint.residentBytes = std::int64_t(taskInfo.resident_size);
+  }
+
+  malloc_statistics_t mallocStatistics;
+  malloc_zone_statistics(nullptr, &mallocStatistics);
+  footprint.heapBytes = std::int64_t(mallocStatistics.size_in_use);
+
+  thread_act_array_t threads;
+  mach_msg_type_number_t numThreads = 0;
+  if (task_threads(mach_task_self(), &threads, &numThreads) == KERN_SUCCESS)
+  {
+    footprint.numThreads = int(numThreads);
+    for (mach_msg_type_number_t i = 0; i < numThreads; ++i)
+    {
+      mach_port_deallocate(mach_task_self(), threads[i]);
+    }
+    vm_deallocate(mach_task_self(), vm_address_t(threads),
+                  numThreads * sizeof(thread_act_t));
+  }
+#endif
+
+  return footprint;
+}
+
+
+// Leaves out what the platform can't measure
+juce::var growthBetween(const Footprint& before, const Footprint& after)
+{
+  using namespace frut::harness;
+
+  auto growth = makeObject();
+  if (after.residentBytes >= 0 && before.residentBytes >= 0)
+  {
+    setProperty(growth, "rss_bytes", after.residentBytes - before.residentBytes);
+  }
+  if (after.heapBytes >= 0 && before.heapBytes >= 0)
+  {
+    setProperty(growth, "heap_bytes", after.heapBytes - before.heapBytes);
+  }
+  if (after.numThreads >= 0 && before.numThreads >= 0)
+  {
+    setProperty(growth, "threads", after.numThreads - before.numThreads);
+  }
+  return growth;
+}
+
+
+juce::var footprintToVar(const Footprint& footprint)
+{
+  using namespace frut::harness;
+
+  auto result = makeObject();
+  setProperty(result, "rss_bytes", footprint.residentBytes);
+  setProperty(result, "heap_bytes", footprint.heapBytes);
+  setProperty(result, "threads", footprint.numThreads);
+  return result;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  const auto numInstances =
+    std::max(1, commandLine.getValue("--instances", "10").getIntValue());
+  const auto sampleRates = commandLine.getIntList("--sample-rates", "44100,48000,96000");
+  const auto blockSizes = commandLine.getIntList("--block-sizes", "64,512,2048");
+  const auto withEditor = !commandLine.hasFlag("--no-editor");
+
+  const auto isPositive = [](int value) { return value > 0; };
+  if (sampleRates.empty() || blockSizes.empty()
+      || !std::all_of(sampleRates.begin(), sampleRates.end(), isPositive)
+      || !std::all_of(blockSizes.begin(), blockSizes.end(), isPositive))
+  {
+    std::cerr << "--sample-rates and --block-sizes must be lists of positive numbers"
+              << std::endl;
+    return 1;
+  }
+
+  const auto baseline = getFootprint();
+
+  auto report = makeObject();
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+  setProperty(report, "baseline", footprintToVar(baseline));
+
+  // Instances stay alive until the end, as in a host session
+  std::vector<std::unique_ptr<juce::AudioProcessor>> processors;
+  juce::var instances;
+  Footprint afterFirstInstance;
+
+  // The report is only filled in after each instance has been measured, so that its
+  // allocations don't count as heap growth
+  std::vector<Footprint> afterPrepares;
+  afterPrepares.reserve(sampleRates.size() * blockSizes.size());
+
+  for (auto instanceIndex = 0; instanceIndex < numInstances; ++instanceIndex)
+  {
+    const auto beforeConstruction = getFootprint();
+    processors.push_back(createProcessor());
+    auto& processor = *processors.back();
+    const auto afterConstruction = getFootprint();
+
+    afterPrepares.clear();
+    for (const auto sampleRate : sampleRates)
+    {
+      for (const auto blockSize : blockSizes)
+      {
+        processor.setRateAndBufferSizeDetails(double(sampleRate), blockSize);
+        processor.prepareToPlay(double(sampleRate), blockSize);
+        afterPrepares.push_back(getFootprint());
+        processor.releaseResources();
+      }
+    }
+    const auto afterReleaseResources = getFootprint();
+
+    const auto hasEditor = withEditor && processor.hasEditor();
+    Footprint afterEditorCreation;
+    if (hasEditor)
+    {
+      std::unique_ptr<juce::AudioProcessorEditor> editor{
+        processor.createEditorIfNeeded()};
+      afterEditorCreation = getFootprint();
+    }
+    const auto afterEditorDeletion = getFootprint();
+
+    // Leave the instance prepared, as a host would while the session plays
+    processor.setRateAndBufferSizeDetails(double(sampleRates.front()),
+                                          blockSizes.front());
+    processor.prepareToPlay(double(sampleRates.front()), blockSizes.front());
+    const auto afterInstance = getFootprint();
+
+    if (instanceIndex == 0)
+    {
+      afterFirstInstance = afterInstance;
+    }
+
+    auto instance = makeObject();
+    setProperty(instance, "index", instanceIndex);
+    setProperty(instance, "construction",
+                growthBetween(beforeConstruction, afterConstruction));
+
+    juce::var prepares;
+    auto afterPrepare = afterPrepares.begin();
+    for (const auto sampleRate : sampleRates)
+    {
+      for (const auto blockSize : blockSizes)
+      {
+        auto prepare = growthBetween(afterConstruction, *afterPrepare++);
+        setProperty(prepare, "sample_rate", sampleRate);
+        setProperty(prepare, "block_size", blockSize);
+        prepares.append(prepare);
+      }
+    }
+    setProperty(instance, "prepare_to_play", prepares);
+    setProperty(instance, "retained_after_release_resources",
+                growthBetween(afterConstruction, afterReleaseResources));
+
+    if (hasEditor)
+    {
+      setProperty(instance, "editor",
+                  growthBetween(afterReleaseResources, afterEditorCreation));
+      setProperty(instance, "retained_after_editor_deletion",
+                  growthBetween(afterReleaseResources, afterEditorDeletion));
+    }
+
+    setProperty(instance, "total", growthBetween(beforeConstruction, afterInstance));
+    instances.append(instance);
+  }
+  setProperty(report, "instances", instances);
+
+  const auto total = getFootprint();
+  setProperty(report, "total", footprintToVar(total));
+  setProperty(report, "growth", growthBetween(baseline, total));
+
+  // The first instance also pays for static data shared by all instances
+  if (numInstances > 1)
+  {
+    const auto average = [&](std::int64_t totalValue, std::int64_t firstInstanceValue) {
+      return double(totalValue - firstInstanceValue) / double(numInstances - 1);
+    };
+    auto perInstance = makeObject();
+    if (total.residentBytes >= 0)
+    {
+      setProperty(perInstance, "rss_bytes",
+                  average(total.residentBytes, afterFirstInstance.residentBytes));
+    }
+    if (total.heapBytes >= 0)
+    {
+      setProperty(perInstance, "heap_bytes",
+                  average(total.heapBytes, afterFirstInstance.heapBytes));
+    }
+    if (total.numThreads >= 0)
+    {
+      setProperty(perInstance, "threads",
+                  average(total.numThreads, afterFirstInstance.numThreads));
+    }
+    setProperty(report, "average_after_first_instance", perInstance);
+  }
+
+  processors.clear();
+
+  return writeReport(commandLine, report);
+}
@@ -0,0 +1,265 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Helpers shared by the harness executables that Reprojucer.cmake can add next to the
+// Shared Code target of "Audio Plug-in" projects. Each harness is a single .cpp file
+// that includes this header and links against <target>_Shared_Code. The editor benchmark
+// of "GUI Application" projects uses it as well, so plugin-specific helpers are only
+// declared when the audio modules are available.
+
+#pragma once
+
+#include "JuceHeader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+#if JUCE_MODULE_AVAILABLE_juce_audio_processors
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+#endif
+
+
+namespace frut
+{
+namespace harness
+{
+
+using Clock = std::chrono::steady_clock;
+
+
+inline std::int64_t nanosecondsSince(Clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+    .count();
+}
+
+
+class CommandLine
+{
+public:
+  CommandLine(int argc, char* argv[])
+  {
+    for (auto i = 1; i < argc; ++i)
+    {
+      mArgs.add(juce::String::fromUTF8(argv[i]));
+    }
+  }
+
+  bool hasFlag(const juce::String& name) const
+  {
+    return mArgs.contains(name);
+  }
+
+  juce::String getValue(const juce::String& name, const juce::String& defaultValue) const
+  {
+    const auto index = mArgs.indexOf(name);
+    if (index >= 0 && index + 1 < mArgs.size())
+    {
+      return mArgs[index + 1];
+    }
+    return defaultValue;
+  }
+
+  // Returns the values of every occurrence of "name", e.g. "--input a --input b"
+  juce::StringArray getValues(const juce::String& name) const
+  {
+    juce::StringArray values;
+    for (auto i = 0; i + 1 < mArgs.size(); ++i)
+    {
+      if (mArgs[i] == name)
+      {
+        values.add(mArgs[++i]);
+      }
+    }
+    return values;
+  }
+
+  std::vector<int> getIntList(const juce::String& name,
+                              const juce::String& defaultValue) const
+  {
+    std::vector<int> values;
+    for (const auto& token :
+         juce::StringArray::fromTokens(getValue(name, defaultValue), ",", {}))
+    {
+      if (token.trim().isNotEmpty())
+      {
+        values.push_back(token.trim().getIntValue());
+      }
+    }
+    return values;
+  }
+
+private:
+  juce::StringArray mArgs;
+};
+
+
+struct ChannelLayout
+{
+  int numInputs;
+  int numOutputs;
+
+  juce::String toString() const
+  {
+    return juce::String{numInputs} + "-" + juce::String{numOutputs};
+  }
+};
+
+
+// Parses "<ins>-<outs>[,<ins>-<outs>...]", e.g. "2-2,1-2,0-2"
+inline std::vector<ChannelLayout> parseChannelLayouts(const juce::String& text)
+{
+  std::vector<ChannelLayout> layouts;
+  for (const auto& token : juce::StringArray::fromTokens(text, ",", {}))
+  {
+    if (token.containsChar('-'))
+    {
+      layouts.push_back({token.upToFirstOccurrenceOf("-", false, false).getIntValue(),
+                         token.fromFirstOccurrenceOf("-", false, false).getIntValue()});
+    }
+  }
+  return layouts;
+}
+
+
+#if JUCE_MODULE_AVAILABLE_juce_audio_processors
+
+inline std::unique_ptr<juce::AudioProcessor> createProcessor()
+{
+  return std::unique_ptr<juce::AudioProcessor>{createPluginFilter()};
+}
+
+
+// Tries to set the main input and output buses to the requested channel counts. The
+// processor keeps its current layout when it rejects the requested one.
+inline bool applyChannelLayout(juce::AudioProcessor& processor,
+                               const ChannelLayout& channelLayout)
+{
+  auto layout = processor.getBusesLayout();
+
+  if (layout.inputBuses.size() > 0)
+  {
+    layout.inputBuses.getReference(0) =
+      juce::AudioChannelSet::canonicalChannelSet(channelLayout.numInputs);
+  }
+  else if (channelLayout.numInputs > 0)
+  {
+    return false;
+  }
+
+  if (layout.outputBuses.size() > 0)
+  {
+    layout.outputBuses.getReference(0) =
+      juce::AudioChannelSet::canonicalChannelSet(channelLayout.numOutputs);
+  }
+  else if (channelLayout.numOutputs > 0)
+  {
+    return false;
+  }
+
+  return processor.setBusesLayout(layout);
+}
+
+#endif // JUCE_MODULE_AVAILABLE_juce_audio_processors
+
+
+#if JUCE_MODULE_AVAILABLE_juce_audio_basics
+
+inline void fillWithNoise(juce::AudioBuffer<float>& buffer, juce::Random& random)
+{
+  for (auto channel = 0; channel < buffer.getNumChannels(); ++channel)
+  {
+    auto* samples = buffer.getWritePointer(channel);
+    for (auto i = 0; i < buffer.getNumSamples(); ++i)
+    {
+      samples[i] = random.nextFloat() * 0.5f - 0.25f;
+    }
+  }
+}
+
+
+// Adds a note-on and the matching note-off to every block, walking up an octave so
+// that synths keep voices allocated and busy
+inline void fillWithNotes(juce::MidiBuffer& midi, int blockIndex, int blockSize)
+{
+  midi.clear();
+  const auto noteNumber = 60 + (blockIndex % 12);
+  midi.addEvent(juce::MidiMessage::noteOn(1, noteNumber, juce::uint8{100}), 0);
+  midi.addEvent(juce::MidiMessage::noteOff(1, 60 + ((blockIndex + 11) % 12)),
+                blockSize / 2);
+}
+
+#endif // JUCE_MODULE_AVAILABLE_juce_audio_basics
+
+
+// Nearest-rank percentile, sorts values in place
+inline double percentile(std::vector<double>& values, double fraction)
+{
+  if (values.empty())
+  {
+    return 0.0;
+  }
+
+  std::sort(values.begin(), values.end());
+  const auto rank = static_cast<std::size_t>(fraction * double(values.size() - 1) + 0.5);
+  return values[std::min(rank, values.size() - 1)];
+}
+
+
+inline juce::var makeObject()
+{
+  return juce::var{new juce::DynamicObject{}};
+}
+
+
+inline void setProperty(juce::var& object, const juce::Identifier& name,
+                        const juce::var& value)
+{
+  object.getDynamicObject()->setProperty(name, value);
+}
+
+
+// Writes the JSON report to the file given with "--output", or to stdout
+inline int writeReport(const CommandLine& commandLine, const juce::var& report)
+{
+  const auto json = juce::JSON::toString(report);
+  const auto outputPath = commandLine.getValue("--output", {});
+
+  if (outputPath.isEmpty())
+  {
+    std::cout << json << std::endl;
+    return 0;
+  }
+
+  const auto outputFile =
+    juce::File::getCurrentWorkingDirectory().getChildFile(outputPath);
+  if (!outputFile.replaceWithText(json + "\n"))
+  {
+    std::cerr << "Failed to write " << outputFile.getFullPathName() << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace harness
+} // namespace frut
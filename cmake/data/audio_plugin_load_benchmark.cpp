@@ -0,0 +1,545 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_LoadBenchmark (Linux only): measures how long it takes a host to dlopen() the
+// VST3 module, to get its factory and to get a prepared processor, and counts the dynamic
+// relocations and static initialisers of the VST3 module and of the Standalone
+// executable. Unlike the other harnesses, it doesn't link against the Shared Code target,
+// so that none of the plugin's dependencies are already loaded when it is measured.
+//
+// Each load happens in a fresh child process. The "cold" load runs after asking the
+// kernel to drop the cached pages of the module (best effort, see posix_fadvise(2)), the
+// "warm" loads run with the module in the page cache.
+//
+// usage: <target>_LoadBenchmark [--vst3 <module.so>]
+//                               [--standalone <executable>]
+//                               [--repetitions <warm-load-count>]
+//                               [--sample-rate 48000]
+//                               [--block-size 512]
+//                               [--output <json-file>]
+
+#if FRUT_LOAD_BENCHMARK_HAS_VST3
+  #include "pluginterfaces/base/ipluginbase.h"
+  #include "pluginterfaces/vst/ivstaudioprocessor.h"
+  #include "pluginterfaces/vst/ivstcomponent.h"
+#endif
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+
+std::string getArgument(const std::vector<std::string>& args, const std::string& name,
+                        const std::string& defaultValue)
+{
+  const auto it = std::find(args.begin(), args.end(), name);
+  if (it != args.end() && std::next(it) != args.end())
+  {
+    return *std::next(it);
+  }
+  return defaultValue;
+}
+
+
+void printUsage(const std::string& executable)
+{
+  std::cerr << "usage: " << executable << " [--vst3 <module.so>]"
+            << " [--standalone <executable>]"
+            << " [--repetitions <warm-load-count>]"
+            << " [--sample-rate 48000]"
+            << " [--block-size 512]"
+            << " [--output <json-file>]" << std::endl;
+}
+
+
+// Every option takes a value, so args must be a sequence of known option/value pairs
+bool checkOptions(const std::vector<std::string>& args)
+{
+  const std::vector<std::string> knownOptions{"--vst3",        "--standalone",
+                                              "--repetitions", "--sample-rate",
+                                              "--block-size",  "--output"};
+
+  for (auto i = std::size_t{1}; i < args.size(); i += 2)
+  {
+    if (std::find(knownOptions.begin(), knownOptions.end(), args.at(i))
+        == knownOptions.end())
+    {
+      std::cerr << "Unknown option: " << args.at(i) << std::endl;
+      return false;
+    }
+
+    if (i + 1 == args.size())
+    {
+      std::cerr << "Missing value for option: " << args.at(i) << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+bool parsePositiveInt(const std::string& text, int& value)
+{
+  char* end = nullptr;
+  errno = 0;
+  const auto parsed = std::strtol(text.c_str(), &end, 10);
+  if (text.empty() || *end != '\0' || errno == ERANGE || parsed <= 0 || parsed > INT_MAX)
+  {
+    return false;
+  }
+  value = static_cast<int>(parsed);
+  return true;
+}
+
+
+bool parsePositiveDouble(const std::string& text, double& value)
+{
+  char* end = nullptr;
+  errno = 0;
+  const auto parsed = std::strtod(text.c_str(), &end);
+  if (text.empty() || *end != '\0' || errno == ERANGE || !(parsed > 0.0))
+  {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+
+std::string quoted(const std::string& text)
+{
+  std::string result = "\"";
+  for (const auto c : text)
+  {
+    if (c == '"' || c == '\\')
+    {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result + "\"";
+}
+
+
+struct ElfStats
+{
+  bool valid = false;
+  std::uint64_t relocations = 0;
+  std::uint64_t relativeRelocations = 0;
+  std::uint64_t pltRelocations = 0;
+  std::uint64_t staticInitialisers = 0;
+};
+
+
+bool isRelativeRelocation(std::uint64_t type)
+{
+#if defined(__x86_64__)
+  return type == R_X86_64_RELATIVE;
+#elif defined(__i386__)
+  return type == R_386_RELATIVE;
+#elif defined(__aarch64__)
+  return type == R_AARCH64_RELATIVE;
+#elif defined(__arm__)
+  return type == R_ARM_RELATIVE;
+#else
+  return false;
+#endif
+}
+
+
+// Reads the section headers of an ELF file of the host's class, counts the entries of the
+// allocated REL/RELA sections (i.e. the dynamic relocations) and of .init_array
+ElfStats getElfStats(const std::string& path)
+{
+  ElfStats stats;
+
+  std::ifstream stream{path, std::ios::binary};
+  const std::vector<char> data{std::istreambuf_iterator<char>{stream},
+                               std::istreambuf_iterator<char>{}};
+  if (data.size() < sizeof(ElfW(Ehdr)))
+  {
+    return stats;
+  }
+
+  ElfW(Ehdr) header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0
+      || header.e_shentsize != sizeof(ElfW(Shdr))
+      || header.e_shoff + header.e_shnum * sizeof(ElfW(Shdr)) > data.size())
+  {
+    return stats;
+  }
+
+  for (auto i = 0; i < header.e_shnum; ++i)
+  {
+    ElfW(Shdr) section;
+    std::memcpy(&section, data.data() + header.e_shoff + i * sizeof(ElfW(Shdr)),
+                sizeof(section));
+
+    if (section.sh_type == SHT_INIT_ARRAY)
+    {
+      stats.staticInitialisers += section.sh_size / sizeof(void*);
+    }
+
+    const auto isRela = section.sh_type == SHT_RELA;
+    if ((!isRela && section.sh_type != SHT_REL) || (section.sh_flags & SHF_ALLOC) == 0
+        || section.sh_entsize == 0 || section.sh_offset + section.sh_size > data.size())
+    {
+      continue;
+    }
+
+    const auto count = section.sh_size / section.sh_entsize;
+    stats.relocations += count;
+    if (section.sh_info != 0) // Relocations applying to a section, i.e. .rela.plt
+    {
+      stats.pltRelocations += count;
+    }
+
+    for (std::uint64_t j = 0; j < count; ++j)
+    {
+      const auto* entry = data.data() + section.sh_offset + j * section.sh_entsize;
+      std::uint64_t info = 0;
+      if (isRela)
+      {
+        ElfW(Rela) relocation;
+        std::memcpy(&relocation, entry, sizeof(relocation));
+        info = relocation.r_info;
+      }
+      else
+      {
+        ElfW(Rel) relocation;
+        std::memcpy(&relocation, entry, sizeof(relocation));
+        info = relocation.r_info;
+      }
+#if __SIZEOF_POINTER__ == 8
+      const auto type = ELF64_R_TYPE(info);
+#else
+      const auto type = ELF32_R_TYPE(info);
+#endif
+      if (isRelativeRelocation(type))
+      {
+        ++stats.relativeRelocations;
+      }
+    }
+  }
+
+  stats.valid = true;
+  return stats;
+}
+
+
+std::string toJson(const ElfStats& stats)
+{
+  std::ostringstream json;
+  json << "{\"dynamic_relocations\": " << stats.relocations
+       << ", \"relative_relocations\": " << stats.relativeRelocations
+       << ", \"plt_relocations\": " << stats.pltRelocations
+       << ", \"static_initialisers\": " << stats.staticInitialisers << "}";
+  return json.str();
+}
+
+
+#if FRUT_LOAD_BENCHMARK_HAS_VST3
+
+struct LoadTimes
+{
+  bool ok = false;
+  double loadMs = 0.0;
+  double factoryMs = 0.0;
+  double preparedMs = 0.0;
+};
+
+
+double millisecondsBetween(Clock::time_point start, Clock::time_point end)
+{
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+
+// Runs in the child process: loads the module the way a Linux VST3 host does, then
+// creates, initializes and activates the first audio processor of the factory
+LoadTimes loadVST3(const std::string& path, double sampleRate, int blockSize)
+{
+  using namespace Steinberg;
+
+  LoadTimes times;
+  const auto start = Clock::now();
+
+  auto* handle = dlopen(path.c_str(), RTLD_LAZY | RTLD_LOCAL);
+  if (handle == nullptr)
+  {
+    std::cerr << dlerror() << std::endl;
+    return times;
+  }
+  const auto loaded = Clock::now();
+
+  using ModuleEntryProc = bool (*)(void*);
+  using ModuleExitProc = bool (*)();
+  using GetFactoryProc = IPluginFactory* (*)();
+
+  const auto moduleEntry =
+    reinterpret_cast<ModuleEntryProc>(dlsym(handle, "ModuleEntry"));
+  const auto moduleExit = reinterpret_cast<ModuleExitProc>(dlsym(handle, "ModuleExit"));
+  const auto getFactory =
+    reinterpret_cast<GetFactoryProc>(dlsym(handle, "GetPluginFactory"));
+  if (getFactory == nullptr || (moduleEntry != nullptr && !moduleEntry(handle)))
+  {
+    return times;
+  }
+
+  auto* factory = getFactory();
+  if (factory == nullptr)
+  {
+    return times;
+  }
+  const auto gotFactory = Clock::now();
+
+  Vst::IComponent* component = nullptr;
+  for (auto i = 0; i < factory->countClasses() && component == nullptr; ++i)
+  {
+    PClassInfo info;
+    if (factory->getClassInfo(i, &info) == kResultOk
+        && std::strcmp(info.category, kVstAudioEffectClass) == 0)
+    {
+      factory->createInstance(info.cid, Vst::IComponent_iid,
+                              reinterpret_cast<void**>(&component));
+    }
+  }
+
+  Vst::IAudioProcessor* processor = nullptr;
+  if (component != nullptr && component->initialize(nullptr) == kResultOk
+      && component->queryInterface(Vst::IAudioProcessor_iid,
+                                   reinterpret_cast<void**>(&processor))
+           == kResultOk)
+  {
+    Vst::ProcessSetup setup{Vst::kRealtime, Vst::kSample32, blockSize, sampleRate};
+    times.ok = processor->setupProcessing(setup) == kResultOk
+               && component->setActive(true) == kResultOk;
+  }
+  const auto prepared = Clock::now();
+
+  if (times.ok)
+  {
+    component->setActive(false);
+  }
+  if (processor != nullptr)
+  {
+    processor->release();
+  }
+  if (component != nullptr)
+  {
+    component->terminate();
+    component->release();
+  }
+  factory->release();
+  if (moduleExit != nullptr)
+  {
+    moduleExit();
+  }
+
+  times.loadMs = millisecondsBetween(start, loaded);
+  times.factoryMs = millisecondsBetween(start, gotFactory);
+  times.preparedMs = millisecondsBetween(start, prepared);
+  return times;
+}
+
+
+LoadTimes loadVST3InChildProcess(const std::string& path, double sampleRate,
+                                 int blockSize)
+{
+  LoadTimes times;
+
+  int fds[2];
+  if (pipe(fds) != 0)
+  {
+    return times;
+  }
+
+  const auto pid = fork();
+  if (pid == 0)
+  {
+    close(fds[0]);
+    const auto childTimes = loadVST3(path, sampleRate, blockSize);
+    const auto written = write(fds[1], &childTimes, sizeof(childTimes));
+    _exit(written == sizeof(childTimes) ? 0 : 1);
+  }
+
+  close(fds[1]);
+  if (pid > 0)
+  {
+    if (read(fds[0], &times, sizeof(times)) != sizeof(times))
+    {
+      times.ok = false;
+    }
+    waitpid(pid, nullptr, 0);
+  }
+  close(fds[0]);
+  return times;
+}
+
+
+void dropFromPageCache(const std::string& path)
+{
+  const auto fd = open(path.c_str(), O_RDONLY);
+  if (fd >= 0)
+  {
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+}
+
+
+std::string toJson(const LoadTimes& times)
+{
+  std::ostringstream json;
+  json << "{\"ok\": " << (times.ok ? "true" : "false")
+       << ", \"load_ms\": " << times.loadMs << ", \"factory_ms\": " << times.factoryMs
+       << ", \"prepared_ms\": " << times.preparedMs << "}";
+  return json.str();
+}
+
+
+double median(std::vector<double> values)
+{
+  if (values.empty())
+  {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+#endif // FRUT_LOAD_BENCHMARK_HAS_VST3
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  const std::vector<std::string> args{argv, argv + argc};
+
+  if (!checkOptions(args))
+  {
+    printUsage(args.at(0));
+    return 1;
+  }
+
+  auto repetitions = 10;
+  auto sampleRate = 48000.0;
+  auto blockSize = 512;
+
+  if (!parsePositiveInt(getArgument(args, "--repetitions", "10"), repetitions)
+      || !parsePositiveDouble(getArgument(args, "--sample-rate", "48000"), sampleRate)
+      || !parsePositiveInt(getArgument(args, "--block-size", "512"), blockSize))
+  {
+    std::cerr << "Invalid value for --repetitions, --sample-rate or --block-size"
+              << std::endl;
+    printUsage(args.at(0));
+    return 1;
+  }
+
+#ifdef FRUT_LOAD_BENCHMARK_VST3_MODULE
+  const auto vst3Path = getArgument(args, "--vst3", FRUT_LOAD_BENCHMARK_VST3_MODULE);
+#else
+  const auto vst3Path = getArgument(args, "--vst3", "");
+#endif
+#ifdef FRUT_LOAD_BENCHMARK_STANDALONE_EXECUTABLE
+  const auto standalonePath =
+    getArgument(args, "--standalone", FRUT_LOAD_BENCHMARK_STANDALONE_EXECUTABLE);
+#else
+  const auto standalonePath = getArgument(args, "--standalone", "");
+#endif
+
+  std::ostringstream json;
+  json << "{";
+
+  if (!vst3Path.empty())
+  {
+    json << "\"vst3\": {\"path\": " << quoted(vst3Path)
+         << ", \"elf\": " << toJson(getElfStats(vst3Path));
+
+#if FRUT_LOAD_BENCHMARK_HAS_VST3
+    dropFromPageCache(vst3Path);
+    const auto cold = loadVST3InChildProcess(vst3Path, sampleRate, blockSize);
+    json << ", \"cold\": " << toJson(cold);
+
+    std::vector<double> loadMs, factoryMs, preparedMs;
+    json << ", \"warm\": [";
+    for (auto i = 0; i < repetitions; ++i)
+    {
+      const auto warm = loadVST3InChildProcess(vst3Path, sampleRate, blockSize);
+      json << (i > 0 ? ", " : "") << toJson(warm);
+      if (warm.ok)
+      {
+        loadMs.push_back(warm.loadMs);
+        factoryMs.push_back(warm.factoryMs);
+        preparedMs.push_back(warm.preparedMs);
+      }
+    }
+    json << "], \"warm_median\": {\"load_ms\": " << median(loadMs)
+         << ", \"factory_ms\": " << median(factoryMs)
+         << ", \"prepared_ms\": " << median(preparedMs) << "}";
+#endif
+
+    json << "}";
+  }
+
+  if (!standalonePath.empty())
+  {
+    json << (vst3Path.empty() ? "" : ", ") << "\"standalone\": {\"path\": "
+         << quoted(standalonePath)
+         << ", \"elf\": " << toJson(getElfStats(standalonePath)) << "}";
+  }
+
+  json << "}";
+
+  const auto outputPath = getArgument(args, "--output", "");
+  if (outputPath.empty())
+  {
+    std::cout << json.str() << std::endl;
+    return 0;
+  }
+
+  std::ofstream output{outputPath};
+  output << json.str() << std::endl;
+  return output ? 0 : 1;
+}
@@ -0,0 +1,341 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_RealtimeSafetyCheck: calls processBlock() with allocation, locking and
+// blocking system calls hooked, and reports every such call made on the audio thread.
+// It exits with 1 when at least one violation was found.
+//
+// operator new and operator delete are replaced on all platforms. With glibc, malloc()
+// and friends, pthread mutex/rwlock/condition variable waits, semaphores, sleeps, read(),
+// write() and poll() are interposed as well, and a stack trace is recorded for each
+// violation.
+//
+// usage: <target>_RealtimeSafetyCheck [--sample-rate 48000]
+//                                     [--block-size 512]
+//                                     [--channels <ins>-<outs>]
+//                                     [--blocks <count>]
+//                                     [--warmup-blocks <count>]
+//                                     [--output <json-file>]
+
+#include "audio_plugin_allocation_hooks.h"
+#include "audio_plugin_harness.h"
+
+#include <array>
+#include <atomic>
+
+#if FRUT_HOOK_LIBC
+  #include <dlfcn.h>
+  #include <execinfo.h>
+  #include <poll.h>
+  #include <pthread.h>
+  #include <semaphore.h>
+  #include <unistd.h>
+  #include <ctime>
+  // Keeps the frames skipped by getStackTrace() in the stack traces
+  #define FRUT_NOINLINE __attribute__((noinline))
+#else
+  #define FRUT_NOINLINE
+#endif
+
+
+namespace
+{
+
+constexpr auto kMaxFrames = 32;
+constexpr auto kMaxViolations = 256;
+
+struct Violation
+{
+  const char* kind;
+  int block;
+  int numFrames;
+  int numSkippedFrames;
+  void* frames[kMaxFrames];
+};
+
+// Violations are recorded in preallocated storage, since the hooks must not allocate
+std::array<Violation, kMaxViolations> gViolations;
+std::atomic<int> gNumViolations{0};
+std::atomic<int> gCurrentBlock{0};
+
+thread_local bool tOnAudioThread = false;
+thread_local bool tInHook = false;
+
+
+// numSkippedFrames is the number of frames of the stack trace that belong to the
+// recording itself, i.e. this function and the hook calling it
+FRUT_NOINLINE void recordViolation(const char* kind, int numSkippedFrames = 1)
+{
+  if (!tOnAudioThread || tInHook)
+  {
+    return;
+  }
+
+  tInHook = true;
+  const auto index = gNumViolations.fetch_add(1);
+  if (index < kMaxViolations)
+  {
+    auto& violation = gViolations[std::size_t(index)];
+    violation.kind = kind;
+    violation.block = gCurrentBlock.load();
+    violation.numSkippedFrames = numSkippedFrames;
+#if FRUT_HOOK_LIBC
+    violation.numFrames = backtrace(violation.frames, kMaxFrames);
+#else
+    violation.numFrames = 0;
+#endif
+  }
+  tInHook = false;
+}
+
+
+struct ScopedAudioThread
+{
+  ScopedAudioThread()
+  {
+    tOnAudioThread = true;
+  }
+
+  ~ScopedAudioThread()
+  {
+    tOnAudioThread = false;
+  }
+};
+
+} // namespace
+
+
+FRUT_NOINLINE void frut::harness::onAllocation(const char* function, std::size_t) noexcept
+{
+  recordViolation(function, 2);
+}
+
+
+FRUT_NOINLINE void frut::harness::onDeallocation(const char* function) noexcept
+{
+  recordViolation(function, 2);
+}
+
+
+#if FRUT_HOOK_LIBC
+
+namespace
+{
+
+// Looks up the libc/libpthread definition that the hook below shadows. dlsym() may call
+// calloc(), which is fine since the allocation hooks don't use dlsym().
+template <typename Function>
+Function* nextSymbol(const char* name)
+{
+  return reinterpret_cast<Function*>(dlsym(RTLD_NEXT, name));
+}
+
+} // namespace
+
+
+  #define FRUT_FORWARD_BLOCKING_CALL(name, ...)                                          \
+    recordViolation(#name);                                                              \
+    static const auto next = nextSymbol<decltype(name)>(#name);                          \
+    return next(__VA_ARGS__)
+
+extern "C" {
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+  FRUT_FORWARD_BLOCKING_CALL(pthread_mutex_lock, mutex);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t* rwlock) noexcept
+{
+  FRUT_FORWARD_BLOCKING_CALL(pthread_rwlock_rdlock, rwlock);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t* rwlock) noexcept
+{
+  FRUT_FORWARD_BLOCKING_CALL(pthread_rwlock_wrlock, rwlock);
+}
+
+int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex)
+{
+  FRUT_FORWARD_BLOCKING_CALL(pthread_cond_wait, cond, mutex);
+}
+
+int pthread_cond_timedwait(pthread_cond_t* cond, pthread_mutex_t* mutex,
+                           const struct timespec* abstime)
+{
+  FRUT_FORWARD_BLOCKING_CALL(pthread_cond_timedwait, cond, mutex, abstime);
+}
+
+int pthread_join(pthread_t thread, void** result)
+{
+  FRUT_FORWARD_BLOCKING_CALL(pthread_join, thread, result);
+}
+
+int sem_wait(sem_t* sem)
+{
+  FRUT_FORWARD_BLOCKING_CALL(sem_wait, sem);
+}
+
+int nanosleep(const struct timespec* duration, struct timespec* remaining)
+{
+  FRUT_FORWARD_BLOCKING_CALL(nanosleep, duration, remaining);
+}
+
+int usleep(useconds_t microseconds)
+{
+  FRUT_FORWARD_BLOCKING_CALL(usleep, microseconds);
+}
+
+unsigned int sleep(unsigned int seconds)
+{
+  FRUT_FORWARD_BLOCKING_CALL(sleep, seconds);
+}
+
+ssize_t read(int fd, void* buffer, size_t count)
+{
+  FRUT_FORWARD_BLOCKING_CALL(read, fd, buffer, count);
+}
+
+ssize_t write(int fd, const void* buffer, size_t count)
+{
+  FRUT_FORWARD_BLOCKING_CALL(write, fd, buffer, count);
+}
+
+int poll(struct pollfd* fds, nfds_t numFds, int timeout)
+{
+  FRUT_FORWARD_BLOCKING_CALL(poll, fds, numFds, timeout);
+}
+
+} // extern "C"
+
+  #undef FRUT_FORWARD_BLOCKING_CALL
+
+#endif // FRUT_HOOK_LIBC
+
+
+namespace
+{
+
+juce::var getStackTrace(const Violation& violation)
+{
+  juce::var frames = juce::Array<juce::var>{};
+#if FRUT_HOOK_LIBC
+  if (auto* symbols = backtrace_symbols(violation.frames, violation.numFrames))
+  {
+    // Skip the frames of recordViolation() and of its callers inside this file
+    for (auto i = violation.numSkippedFrames; i < violation.numFrames; ++i)
+    {
+      frames.append(juce::String{symbols[i]});
+    }
+    free(symbols);
+  }
+#else
+  juce::ignoreUnused(violation);
+#endif
+  return frames;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+#if FRUT_HOOK_LIBC
+  // backtrace() loads libgcc_s on first use, which must not happen inside a hook
+  void* warmupFrames[1];
+  backtrace(warmupFrames, 1);
+#endif
+
+  const auto sampleRate = commandLine.getValue("--sample-rate", "48000").getDoubleValue();
+  const auto blockSize = commandLine.getValue("--block-size", "512").getIntValue();
+  const auto channelLayouts =
+    parseChannelLayouts(commandLine.getValue("--channels", "2-2"));
+  const auto numBlocks = commandLine.getValue("--blocks", "1000").getIntValue();
+  const auto warmupBlocks = commandLine.getValue("--warmup-blocks", "0").getIntValue();
+
+  auto report = makeObject();
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+  setProperty(report, "sample_rate", sampleRate);
+  setProperty(report, "block_size", blockSize);
+  setProperty(report, "blocks", numBlocks);
+  setProperty(report, "libc_hooks", bool(FRUT_HOOK_LIBC));
+
+  auto processor = createProcessor();
+  if (channelLayouts.empty() || !applyChannelLayout(*processor, channelLayouts.front()))
+  {
+    std::cerr << "Unsupported channel layout" << std::endl;
+    return 1;
+  }
+  setProperty(report, "channels", channelLayouts.front().toString());
+
+  processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+  processor->prepareToPlay(sampleRate, blockSize);
+
+  const auto numChannels = std::max(processor->getTotalNumInputChannels(),
+                                     processor->getTotalNumOutputChannels());
+  juce::AudioBuffer<float> buffer{numChannels, blockSize};
+  juce::MidiBuffer midi;
+  midi.ensureSize(1024);
+  juce::Random random{0x46525554};
+  const auto acceptsMidi = processor->acceptsMidi();
+
+  for (auto blockIndex = -warmupBlocks; blockIndex < numBlocks; ++blockIndex)
+  {
+    fillWithNoise(buffer, random);
+    if (acceptsMidi)
+    {
+      fillWithNotes(midi, blockIndex + warmupBlocks, blockSize);
+    }
+
+    gCurrentBlock = blockIndex;
+    if (blockIndex >= 0)
+    {
+      const ScopedAudioThread scopedAudioThread;
+      processor->processBlock(buffer, midi);
+    }
+    else
+    {
+      processor->processBlock(buffer, midi);
+    }
+  }
+
+  processor->releaseResources();
+
+  const auto numViolations = gNumViolations.load();
+  setProperty(report, "violation_count", numViolations);
+
+  juce::var violations = juce::Array<juce::var>{};
+  for (auto i = 0; i < std::min(numViolations, kMaxViolations); ++i)
+  {
+    const auto& violation = gViolations[std::size_t(i)];
+    auto entry = makeObject();
+    setProperty(entry, "kind", violation.kind);
+    setProperty(entry, "block", violation.block);
+    setProperty(entry, "stack", getStackTrace(violation));
+    violations.append(entry);
+  }
+  setProperty(report, "violations", violations);
+
+  const auto result = writeReport(commandLine, report);
+  return numViolations > 0 ? 1 : result;
+}
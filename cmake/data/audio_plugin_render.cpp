@@ -0,0 +1,315 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_Render: renders audio files through the plugin offline, as fast as the
+// machine allows. Files are streamed block by block, so memory use doesn't depend on
+// their length, and several files are rendered in parallel with one processor instance
+// per worker thread. The plugin latency is compensated and its tail is rendered. Output
+// files are written as WAV files named after the input files (with a numeric suffix when
+// several input files share a name), and a JSON report is printed at the end. An input
+// file is never overwritten.
+//
+// usage: <target>_Render (--input <audio-file> | --input-dir <dir>)...
+//                        [--output-dir <dir>]
+//                        [--state <state-file>]
+//                        [--block-size 4096]
+//                        [--jobs <worker-threads>]
+//                        [--bits 16|24|32]
+//                        [--tail-seconds <seconds>]
+//                        [--output <json-file>]
+
+#include "audio_plugin_harness.h"
+
+#if !JUCE_MODULE_AVAILABLE_juce_audio_formats
+  #error "<target>_Render requires the juce_audio_formats module"
+#endif
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+
+namespace
+{
+
+struct RenderSettings
+{
+  juce::File outputDir;
+  juce::MemoryBlock state;
+  int blockSize;
+  int bitsPerSample;
+  double tailSeconds; // negative to use the processor's tail length
+};
+
+
+juce::var renderFile(juce::AudioProcessor& processor, juce::AudioFormatManager& formats,
+                     const juce::File& inputFile, const juce::File& outputFile,
+                     const RenderSettings& settings)
+{
+  using namespace frut::harness;
+
+  auto result = makeObject();
+  setProperty(result, "input", inputFile.getFullPathName());
+
+  if (outputFile == inputFile)
+  {
+    setProperty(result, "error", "output file would overwrite the input file");
+    return result;
+  }
+
+  std::unique_ptr<juce::AudioFormatReader> reader{formats.createReaderFor(inputFile)};
+  if (reader == nullptr)
+  {
+    setProperty(result, "error", "cannot read input file");
+    return result;
+  }
+
+  const auto start = Clock::now();
+  const auto sampleRate = reader->sampleRate;
+  const auto numFileChannels = static_cast<int>(reader->numChannels);
+
+  if (settings.state.getSize() > 0)
+  {
+    processor.setStateInformation(settings.state.getData(),
+                                  static_cast<int>(settings.state.getSize()));
+  }
+  if (!applyChannelLayout(processor, {numFileChannels, numFileChannels}))
+  {
+    setProperty(result, "error", "unsupported channel layout");
+    return result;
+  }
+  processor.setNonRealtime(true);
+  processor.setRateAndBufferSizeDetails(sampleRate, settings.blockSize);
+  processor.prepareToPlay(sampleRate, settings.blockSize);
+
+  const auto numInputs = processor.getTotalNumInputChannels();
+  const auto numOutputs = processor.getTotalNumOutputChannels();
+
+  auto tailSeconds = settings.tailSeconds;
+  if (tailSeconds < 0.0)
+  {
+    // Some processors report an infinite tail
+    tailSeconds = std::min(processor.getTailLengthSeconds(), 30.0);
+  }
+  const auto tailLength = static_cast<juce::int64>(std::ceil(tailSeconds * sampleRate));
+  const auto latency = static_cast<juce::int64>(processor.getLatencySamples());
+  const auto outputLength = reader->lengthInSamples + tailLength;
+
+  outputFile.deleteFile();
+  std::unique_ptr<juce::FileOutputStream> outputStream{outputFile.createOutputStream()};
+  std::unique_ptr<juce::AudioFormatWriter> writer;
+  if (outputStream != nullptr)
+  {
+    juce::WavAudioFormat wavFormat;
+    writer.reset(wavFormat.createWriterFor(outputStream.get(), sampleRate,
+                                           static_cast<unsigned int>(numOutputs),
+                                           settings.bitsPerSample, {}, 0));
+    if (writer != nullptr)
+    {
+      outputStream.release(); // now owned by writer
+    }
+  }
+  if (writer == nullptr)
+  {
+    processor.releaseResources();
+    setProperty(result, "error", "cannot write " + outputFile.getFullPathName());
+    return result;
+  }
+
+  juce::AudioBuffer<float> buffer{std::max({numInputs, numOutputs, 1}),
+                                  settings.blockSize};
+  juce::MidiBuffer midi;
+
+  // The reader returns silence past the end of the file, which feeds the tail
+  for (juce::int64 position = 0, numWritten = 0; numWritten < outputLength;
+       position += settings.blockSize)
+  {
+    reader->read(&buffer, 0, settings.blockSize, position, true, true);
+    for (auto channel = std::min(numInputs, numFileChannels);
+         channel < buffer.getNumChannels(); ++channel)
+    {
+      buffer.clear(channel, 0, settings.blockSize);
+    }
+
+    midi.clear();
+    processor.processBlock(buffer, midi);
+
+    const auto skipped = static_cast<int>(
+      juce::jlimit(juce::int64{0}, juce::int64{settings.blockSize}, latency - position));
+    const auto numSamples = static_cast<int>(std::min(
+      juce::int64{settings.blockSize - skipped}, outputLength - numWritten));
+    if (numSamples > 0)
+    {
+      writer->writeFromAudioSampleBuffer(buffer, skipped, numSamples);
+      numWritten += numSamples;
+    }
+  }
+
+  writer.reset();
+  processor.releaseResources();
+
+  const auto seconds = double(nanosecondsSince(start)) * 1.0e-9;
+  const auto audioSeconds = double(outputLength) / sampleRate;
+  setProperty(result, "output", outputFile.getFullPathName());
+  setProperty(result, "sample_rate", sampleRate);
+  setProperty(result, "channels", ChannelLayout{numInputs, numOutputs}.toString());
+  setProperty(result, "audio_seconds", audioSeconds);
+  setProperty(result, "wall_seconds", seconds);
+  setProperty(result, "realtime_factor", audioSeconds / seconds);
+  return result;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+  const auto cwd = juce::File::getCurrentWorkingDirectory();
+
+  juce::AudioFormatManager formats;
+  formats.registerBasicFormats();
+
+  juce::Array<juce::File> inputFiles;
+  for (const auto& input : commandLine.getValues("--input"))
+  {
+    inputFiles.add(cwd.getChildFile(input));
+  }
+  for (const auto& inputDir : commandLine.getValues("--input-dir"))
+  {
+    cwd.getChildFile(inputDir).findChildFiles(inputFiles, juce::File::findFiles, false,
+                                              formats.getWildcardForAllFormats());
+  }
+  if (inputFiles.isEmpty())
+  {
+    std::cerr << "usage: " << argv[0]
+              << " (--input <audio-file> | --input-dir <dir>)... [--output-dir <dir>]"
+                 " [--state <state-file>] [--block-size 4096] [--jobs <worker-threads>]"
+                 " [--bits 16|24|32] [--tail-seconds <seconds>] [--output <json-file>]"
+              << std::endl;
+    return 1;
+  }
+
+  RenderSettings settings;
+  settings.outputDir = cwd.getChildFile(commandLine.getValue("--output-dir", "rendered"));
+  settings.blockSize =
+    std::max(1, commandLine.getValue("--block-size", "4096").getIntValue());
+  settings.bitsPerSample = commandLine.getValue("--bits", "24").getIntValue();
+  settings.tailSeconds = commandLine.getValue("--tail-seconds", "-1").getDoubleValue();
+
+  const auto statePath = commandLine.getValue("--state", {});
+  if (statePath.isNotEmpty()
+      && !cwd.getChildFile(statePath).loadFileAsData(settings.state))
+  {
+    std::cerr << "Failed to read " << statePath << std::endl;
+    return 1;
+  }
+  if (!settings.outputDir.createDirectory().wasOk())
+  {
+    std::cerr << "Failed to create " << settings.outputDir.getFullPathName() << std::endl;
+    return 1;
+  }
+
+  // Each input file gets its own output file, so that files sharing a name (e.g. a.wav
+  // and a.flac) don't overwrite each other or another input file while being rendered in
+  // parallel
+  juce::Array<juce::File> outputFiles;
+  for (auto fileIndex = 0; fileIndex < inputFiles.size(); ++fileIndex)
+  {
+    const auto baseName = inputFiles[fileIndex].getFileNameWithoutExtension();
+    auto outputFile = settings.outputDir.getChildFile(baseName + ".wav");
+    for (auto suffix = 2; outputFiles.contains(outputFile)
+                          || (inputFiles.contains(outputFile)
+                              && outputFile != inputFiles[fileIndex]);
+         ++suffix)
+    {
+      outputFile =
+        settings.outputDir.getChildFile(baseName + "_" + juce::String{suffix} + ".wav");
+    }
+    outputFiles.add(outputFile);
+  }
+
+  const auto defaultJobs = std::max(1u, std::thread::hardware_concurrency());
+  const auto numJobs = juce::jlimit(
+    1, inputFiles.size(),
+    commandLine.getValue("--jobs", juce::String{int(defaultJobs)}).getIntValue());
+
+  // Processors are created on the main thread, then each worker renders files with its
+  // own processor
+  std::vector<std::unique_ptr<juce::AudioProcessor>> processors;
+  for (auto job = 0; job < numJobs; ++job)
+  {
+    processors.push_back(createProcessor());
+  }
+
+  std::vector<juce::var> results(static_cast<std::size_t>(inputFiles.size()));
+  std::atomic<int> nextFileIndex{0};
+
+  const auto start = Clock::now();
+  std::vector<std::thread> workers;
+  for (auto job = 0; job < numJobs; ++job)
+  {
+    workers.emplace_back([&, job] {
+      juce::AudioFormatManager workerFormats;
+      workerFormats.registerBasicFormats();
+      for (auto fileIndex = nextFileIndex++; fileIndex < inputFiles.size();
+           fileIndex = nextFileIndex++)
+      {
+        results[std::size_t(fileIndex)] =
+          renderFile(*processors[std::size_t(job)], workerFormats, inputFiles[fileIndex],
+                     outputFiles[fileIndex], settings);
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+  const auto seconds = double(nanosecondsSince(start)) * 1.0e-9;
+
+  auto report = makeObject();
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+  setProperty(report, "jobs", numJobs);
+  setProperty(report, "block_size", settings.blockSize);
+
+  juce::var files;
+  auto numFailures = 0;
+  auto audioSeconds = 0.0;
+  for (const auto& result : results)
+  {
+    files.append(result);
+    if (result.hasProperty("error"))
+    {
+      ++numFailures;
+    }
+    else
+    {
+      audioSeconds += double(result["audio_seconds"]);
+    }
+  }
+  setProperty(report, "files", files);
+  setProperty(report, "failures", numFailures);
+  setProperty(report, "wall_seconds", seconds);
+  setProperty(report, "realtime_factor", audioSeconds / seconds);
+
+  const auto reportResult = writeReport(commandLine, report);
+  return numFailures > 0 ? 1 : reportResult;
+}
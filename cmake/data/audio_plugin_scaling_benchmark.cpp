@@ -0,0 +1,274 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_ScalingBenchmark: creates N processor instances and drives their
+// processBlock() calls from T threads, like a host with many instances spread across its
+// worker threads. It prints the throughput of every (instances, threads) combination and
+// the scaling efficiency relative to a single thread, so that shared static state and
+// false sharing show up as a number.
+//
+// usage: <target>_ScalingBenchmark [--instances 1,8,32,128]
+//                                  [--threads 1,2,4,<hardware-threads>]
+//                                  [--pin]
+//                                  [--sample-rate 48000]
+//                                  [--block-size 128]
+//                                  [--channels <ins>-<outs>]
+//                                  [--blocks <blocks-per-instance>]
+//                                  [--output <json-file>]
+
+#include "audio_plugin_harness.h"
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <utility>
+
+
+namespace
+{
+
+struct Instance
+{
+  std::unique_ptr<juce::AudioProcessor> processor;
+  juce::AudioBuffer<float> buffer;
+  juce::MidiBuffer midi;
+};
+
+
+struct RunSettings
+{
+  double sampleRate;
+  int blockSize;
+  int numBlocks;
+  bool pinThreads;
+};
+
+
+// Creates and prepares the instances up front, so that only processBlock() calls are
+// timed
+std::vector<Instance> createInstances(int numInstances,
+                                      const frut::harness::ChannelLayout& channelLayout,
+                                      const RunSettings& settings)
+{
+  using namespace frut::harness;
+
+  std::vector<Instance> instances;
+  instances.reserve(static_cast<std::size_t>(numInstances));
+
+  for (auto i = 0; i < numInstances; ++i)
+  {
+    Instance instance;
+    instance.processor = createProcessor();
+    if (!applyChannelLayout(*instance.processor, channelLayout))
+    {
+      return {};
+    }
+    instance.processor->setRateAndBufferSizeDetails(settings.sampleRate,
+                                                    settings.blockSize);
+    instance.processor->prepareToPlay(settings.sampleRate, settings.blockSize);
+
+    const auto numChannels = std::max(instance.processor->getTotalNumInputChannels(),
+                                      instance.processor->getTotalNumOutputChannels());
+    instance.buffer.setSize(numChannels, settings.blockSize);
+    instance.midi.ensureSize(256);
+    instances.push_back(std::move(instance));
+  }
+
+  return instances;
+}
+
+
+// Each thread processes the instances i, i + T, i + 2T, ... block after block, and
+// returns the wall-clock time taken by the slowest thread
+std::int64_t runThreads(std::vector<Instance>& instances, int numThreads,
+                        const RunSettings& settings)
+{
+  using namespace frut::harness;
+
+  const auto numInstances = static_cast<int>(instances.size());
+  const auto numCores = std::max(1u, std::thread::hardware_concurrency());
+  std::atomic<int> numReadyThreads{0};
+  std::atomic<bool> go{false};
+
+  const auto processInstances = [&](int threadIndex) {
+    if (settings.pinThreads)
+    {
+      juce::Thread::setCurrentThreadAffinityMask(
+        juce::uint32{1} << (unsigned(threadIndex) % std::min(numCores, 32u)));
+    }
+
+    auto maxNumChannels = 0;
+    for (auto i = threadIndex; i < numInstances; i += numThreads)
+    {
+      maxNumChannels =
+        std::max(maxNumChannels, instances[std::size_t(i)].buffer.getNumChannels());
+    }
+    juce::AudioBuffer<float> input{maxNumChannels, settings.blockSize};
+    juce::Random random{0x46525554 + threadIndex};
+    fillWithNoise(input, random);
+
+    ++numReadyThreads;
+    while (!go.load())
+    {
+      std::this_thread::yield();
+    }
+
+    for (auto blockIndex = 0; blockIndex < settings.numBlocks; ++blockIndex)
+    {
+      for (auto i = threadIndex; i < numInstances; i += numThreads)
+      {
+        auto& instance = instances[std::size_t(i)];
+        for (auto channel = 0; channel < instance.buffer.getNumChannels(); ++channel)
+        {
+          instance.buffer.copyFrom(channel, 0, input, channel, 0, settings.blockSize);
+        }
+        if (instance.processor->acceptsMidi())
+        {
+          fillWithNotes(instance.midi, blockIndex, settings.blockSize);
+        }
+        instance.processor->processBlock(instance.buffer, instance.midi);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (auto threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+  {
+    threads.emplace_back(processInstances, threadIndex);
+  }
+  while (numReadyThreads.load() < numThreads)
+  {
+    std::this_thread::yield();
+  }
+
+  const auto start = Clock::now();
+  go = true;
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  return nanosecondsSince(start);
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  const auto hardwareThreads = int(std::max(1u, std::thread::hardware_concurrency()));
+  auto defaultThreads = juce::String{"1"};
+  for (auto numThreads = 2; numThreads < hardwareThreads; numThreads *= 2)
+  {
+    defaultThreads << "," << numThreads;
+  }
+  if (hardwareThreads > 1)
+  {
+    defaultThreads << "," << hardwareThreads;
+  }
+
+  const auto instanceCounts = commandLine.getIntList("--instances", "1,8,32,128");
+  auto threadCounts = commandLine.getIntList("--threads", defaultThreads);
+  std::sort(threadCounts.begin(), threadCounts.end());
+  const auto channelLayouts =
+    parseChannelLayouts(commandLine.getValue("--channels", "2-2"));
+  const auto channelLayout =
+    channelLayouts.empty() ? ChannelLayout{2, 2} : channelLayouts.front();
+
+  RunSettings settings;
+  settings.sampleRate = commandLine.getValue("--sample-rate", "48000").getDoubleValue();
+  settings.blockSize = commandLine.getValue("--block-size", "128").getIntValue();
+  settings.numBlocks = commandLine.getValue("--blocks", "1000").getIntValue();
+  settings.pinThreads = commandLine.hasFlag("--pin");
+
+  auto report = makeObject();
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+  setProperty(report, "sample_rate", settings.sampleRate);
+  setProperty(report, "block_size", settings.blockSize);
+  setProperty(report, "blocks_per_instance", settings.numBlocks);
+  setProperty(report, "channels", channelLayout.toString());
+  setProperty(report, "pinned", settings.pinThreads);
+  setProperty(report, "hardware_threads", hardwareThreads);
+
+  // Instance-blocks per second with a single thread, per instance count
+  std::map<int, double> singleThreadThroughputs;
+
+  juce::var runs;
+  for (const auto numInstances : instanceCounts)
+  {
+    for (const auto numThreads : threadCounts)
+    {
+      if (numInstances <= 0 || numThreads <= 0 || numThreads > numInstances
+          || settings.blockSize <= 0 || settings.numBlocks <= 0)
+      {
+        continue;
+      }
+
+      auto run = makeObject();
+      setProperty(run, "instances", numInstances);
+      setProperty(run, "threads", numThreads);
+
+      auto instances = createInstances(numInstances, channelLayout, settings);
+      if (instances.empty())
+      {
+        setProperty(run, "skipped", "unsupported channel layout");
+        runs.append(run);
+        continue;
+      }
+
+      const auto elapsed = runThreads(instances, numThreads, settings);
+
+      for (auto& instance : instances)
+      {
+        instance.processor->releaseResources();
+      }
+
+      const auto seconds = double(elapsed) * 1.0e-9;
+      const auto instanceBlocks = double(numInstances) * double(settings.numBlocks);
+      const auto throughput = instanceBlocks / seconds;
+      const auto audioSeconds =
+        instanceBlocks * double(settings.blockSize) / settings.sampleRate;
+
+      setProperty(run, "wall_ns", double(elapsed));
+      setProperty(run, "blocks_per_second", throughput);
+      // Number of instances that could run in real time
+      setProperty(run, "realtime_instances", audioSeconds / seconds);
+
+      if (numThreads == 1)
+      {
+        singleThreadThroughputs[numInstances] = throughput;
+      }
+      const auto singleThread = singleThreadThroughputs.find(numInstances);
+      if (singleThread != singleThreadThroughputs.end())
+      {
+        setProperty(run, "speedup", throughput / singleThread->second);
+        setProperty(run, "scaling_efficiency",
+                    throughput / (singleThread->second * double(numThreads)));
+      }
+
+      runs.append(run);
+    }
+  }
+  setProperty(report, "runs", runs);
+
+  return writeReport(commandLine, report);
+}
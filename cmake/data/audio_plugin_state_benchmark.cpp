@@ -0,0 +1,202 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_StateBenchmark: round-trips state blobs through setStateInformation() and
+// getStateInformation(), and prints a JSON report with the latency, the number of
+// allocations and the number of bytes allocated per call, and the size of the blobs.
+// The state of a freshly created processor is always measured, and further blobs (e.g.
+// large presets or sessions captured from a host) can be given with --state. Allocations
+// made through operator new are counted on all platforms, and with glibc, the ones made
+// through malloc() and friends (e.g. by juce::MemoryBlock) are counted as well.
+//
+// usage: <target>_StateBenchmark [--state <state-file>]...
+//                                [--repetitions <count>]
+//                                [--warmup <count>]
+//                                [--save-default-state <state-file>]
+//                                [--output <json-file>]
+
+#include "audio_plugin_allocation_hooks.h"
+#include "audio_plugin_harness.h"
+
+
+namespace
+{
+
+// Allocations are only counted on the thread that calls the state functions, so that
+// the message thread and JUCE's timer thread don't add noise
+thread_local bool tCountAllocations = false;
+thread_local std::uint64_t tNumAllocations = 0;
+thread_local std::uint64_t tNumAllocatedBytes = 0;
+
+} // namespace
+
+
+void frut::harness::onAllocation(const char*, std::size_t size) noexcept
+{
+  if (tCountAllocations)
+  {
+    ++tNumAllocations;
+    tNumAllocatedBytes += size;
+  }
+}
+
+
+void frut::harness::onDeallocation(const char*) noexcept
+{
+}
+
+
+namespace
+{
+
+// Calls fn() warmup + repetitions times, and returns the latency and allocation
+// statistics of the last repetitions calls
+template <typename Function>
+juce::var measure(Function&& fn, int warmup, int repetitions)
+{
+  using namespace frut::harness;
+
+  for (auto i = 0; i < warmup; ++i)
+  {
+    fn();
+  }
+
+  std::vector<double> nanoseconds;
+  nanoseconds.reserve(static_cast<std::size_t>(repetitions));
+  std::uint64_t numAllocations = 0;
+  std::uint64_t numAllocatedBytes = 0;
+
+  for (auto i = 0; i < repetitions; ++i)
+  {
+    tNumAllocations = 0;
+    tNumAllocatedBytes = 0;
+    tCountAllocations = true;
+    const auto start = Clock::now();
+    fn();
+    const auto elapsed = nanosecondsSince(start);
+    tCountAllocations = false;
+
+    nanoseconds.push_back(double(elapsed));
+    numAllocations += tNumAllocations;
+    numAllocatedBytes += tNumAllocatedBytes;
+  }
+
+  const auto maxNanoseconds =
+    nanoseconds.empty() ? 0.0 : *std::max_element(nanoseconds.begin(), nanoseconds.end());
+
+  auto result = makeObject();
+  setProperty(result, "p50_ns", percentile(nanoseconds, 0.50));
+  setProperty(result, "p90_ns", percentile(nanoseconds, 0.90));
+  setProperty(result, "max_ns", maxNanoseconds);
+  setProperty(result, "allocations_per_call",
+              double(numAllocations) / double(repetitions));
+  setProperty(result, "allocated_bytes_per_call",
+              double(numAllocatedBytes) / double(repetitions));
+  return result;
+}
+
+
+juce::var benchmarkState(const juce::String& name, const juce::MemoryBlock& state,
+                         int warmup, int repetitions)
+{
+  using namespace frut::harness;
+
+  auto result = makeObject();
+  setProperty(result, "name", name);
+  setProperty(result, "size", static_cast<juce::int64>(state.getSize()));
+
+  auto processor = createProcessor();
+  const auto* data = state.getData();
+  const auto size = static_cast<int>(state.getSize());
+
+  setProperty(result, "set",
+              measure([&] { processor->setStateInformation(data, size); }, warmup,
+                      repetitions));
+
+  juce::MemoryBlock savedState;
+  setProperty(result, "get",
+              measure(
+                [&] {
+                  savedState.setSize(0);
+                  processor->getStateInformation(savedState);
+                },
+                warmup, repetitions));
+
+  setProperty(result, "round_trip_size", static_cast<juce::int64>(savedState.getSize()));
+  setProperty(result, "round_trip_identical", savedState == state);
+
+  // Hosts create a new instance for every plugin in a session they load
+  setProperty(result, "create_and_set",
+              measure(
+                [&] {
+                  auto newProcessor = createProcessor();
+                  newProcessor->setStateInformation(data, size);
+                },
+                std::min(warmup, 1), std::max(1, repetitions / 10)));
+
+  return result;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+  const auto cwd = juce::File::getCurrentWorkingDirectory();
+
+  const auto repetitions =
+    std::max(1, commandLine.getValue("--repetitions", "100").getIntValue());
+  const auto warmup = std::max(0, commandLine.getValue("--warmup", "5").getIntValue());
+
+  juce::MemoryBlock defaultState;
+  createProcessor()->getStateInformation(defaultState);
+
+  const auto defaultStatePath = commandLine.getValue("--save-default-state", {});
+  if (defaultStatePath.isNotEmpty()
+      && !cwd.getChildFile(defaultStatePath).replaceWithData(defaultState.getData(),
+                                                             defaultState.getSize()))
+  {
+    std::cerr << "Failed to write " << defaultStatePath << std::endl;
+    return 1;
+  }
+
+  auto report = makeObject();
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+  setProperty(report, "repetitions", repetitions);
+
+  juce::var states;
+  states.append(benchmarkState("<default>", defaultState, warmup, repetitions));
+
+  for (const auto& statePath : commandLine.getValues("--state"))
+  {
+    juce::MemoryBlock state;
+    if (!cwd.getChildFile(statePath).loadFileAsData(state))
+    {
+      std::cerr << "Failed to read " << statePath << std::endl;
+      return 1;
+    }
+    states.append(benchmarkState(statePath, state, warmup, repetitions));
+  }
+  setProperty(report, "states", states);
+
+  return writeReport(commandLine, report);
+}
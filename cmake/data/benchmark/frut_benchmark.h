@@ -0,0 +1,157 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Minimal timing harness for executables created with jucer_add_benchmark(), e.g.:
+//
+//   #include "frut_benchmark.h"
+//
+//   FRUT_BENCHMARK(IIRFilter_process)
+//   {
+//     juce::dsp::IIR::Filter<float> filter{...};  // setup, not timed
+//     juce::AudioBuffer<float> buffer{1, 512};
+//     state.setItemsPerRepetition(buffer.getNumSamples());
+//     state.measure([&] {
+//       filter.process(...);  // timed
+//       frut::benchmark::doNotOptimize(buffer);
+//     });
+//   }
+//
+// main() is provided by frut_benchmark_main.cpp.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+
+namespace frut
+{
+namespace benchmark
+{
+
+// Prevents the compiler from optimizing away the computation of value
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+  static const void* volatile sink;
+  sink = &value;
+  _ReadWriteBarrier();
+#else
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+
+class State
+{
+public:
+  State(int warmup, int repetitions)
+    : mWarmup{warmup}
+    , mRepetitions{repetitions}
+  {
+  }
+
+  // Runs function mWarmup times untimed, then mRepetitions times timed
+  template <typename Function>
+  void measure(Function&& function)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    for (auto i = 0; i < mWarmup; ++i)
+    {
+      function();
+    }
+
+    mNanoseconds.clear();
+    mNanoseconds.reserve(static_cast<std::size_t>(mRepetitions));
+    for (auto i = 0; i < mRepetitions; ++i)
+    {
+      const auto start = Clock::now();
+      function();
+      const auto end = Clock::now();
+      mNanoseconds.push_back(
+        std::chrono::duration<double, std::nano>(end - start).count());
+    }
+  }
+
+  // Number of items (e.g. samples) processed by one repetition, used to report the time
+  // per item
+  void setItemsPerRepetition(std::int64_t items)
+  {
+    mItemsPerRepetition = items;
+  }
+
+  int getWarmup() const
+  {
+    return mWarmup;
+  }
+
+  std::int64_t getItemsPerRepetition() const
+  {
+    return mItemsPerRepetition;
+  }
+
+  const std::vector<double>& getNanoseconds() const
+  {
+    return mNanoseconds;
+  }
+
+private:
+  int mWarmup;
+  int mRepetitions;
+  std::int64_t mItemsPerRepetition = 1;
+  std::vector<double> mNanoseconds;
+};
+
+
+using Function = void (*)(State&);
+
+struct Registration
+{
+  const char* name;
+  Function function;
+};
+
+inline std::vector<Registration>& getRegistrations()
+{
+  static std::vector<Registration> registrations;
+  return registrations;
+}
+
+struct Registrar
+{
+  Registrar(const char* name, Function function)
+  {
+    getRegistrations().push_back({name, function});
+  }
+};
+
+} // namespace benchmark
+} // namespace frut
+
+
+#define FRUT_BENCHMARK(name)                                                             \
+  static void frutBenchmark_##name(::frut::benchmark::State& state);                     \
+  static const ::frut::benchmark::Registrar frutBenchmarkRegistrar_##name{               \
+    #name, frutBenchmark_##name};                                                        \
+  static void frutBenchmark_##name(::frut::benchmark::State& state)
@@ -0,0 +1,296 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// usage: <benchmark> [--warmup 10] [--repetitions 100] [--filter <substring>]
+//                    [--output <json-file>]
+//                    [--baseline <json-file> [--tolerance 10] [--update-baseline]]
+
+#include "frut_benchmark.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+
+namespace
+{
+
+std::string getArgument(const std::vector<std::string>& args, const std::string& name,
+                        const std::string& defaultValue)
+{
+  const auto it = std::find(args.begin(), args.end(), name);
+  if (it != args.end() && std::next(it) != args.end())
+  {
+    return *std::next(it);
+  }
+  return defaultValue;
+}
+
+
+bool hasArgument(const std::vector<std::string>& args, const std::string& name)
+{
+  return std::find(args.begin(), args.end(), name) != args.end();
+}
+
+
+void printUsage(const std::string& executable)
+{
+  std::cerr << "usage: " << executable << " [--warmup 10] [--repetitions 100]"
+            << " [--filter <substring>] [--output <json-file>]"
+            << " [--baseline <json-file> [--tolerance 10] [--update-baseline]]"
+            << std::endl;
+}
+
+
+// Returns false if args contains an unknown option or an option without its value
+bool checkOptions(const std::vector<std::string>& args)
+{
+  const std::vector<std::string> optionsWithValue{"--warmup",   "--repetitions",
+                                                  "--filter",   "--output",
+                                                  "--baseline", "--tolerance"};
+
+  for (auto i = std::size_t{1}; i < args.size(); ++i)
+  {
+    if (args.at(i) == "--update-baseline")
+    {
+      continue;
+    }
+
+    if (std::find(optionsWithValue.begin(), optionsWithValue.end(), args.at(i))
+        == optionsWithValue.end())
+    {
+      std::cerr << "Unknown option: " << args.at(i) << std::endl;
+      return false;
+    }
+
+    if (++i == args.size())
+    {
+      std::cerr << "Missing value for option: " << args.at(i - 1) << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+bool parseInt(const std::string& text, int minimum, int& value)
+{
+  char* end = nullptr;
+  errno = 0;
+  const auto parsed = std::strtol(text.c_str(), &end, 10);
+  if (text.empty() || *end != '\0' || errno == ERANGE || parsed < minimum
+      || parsed > INT_MAX)
+  {
+    return false;
+  }
+  value = static_cast<int>(parsed);
+  return true;
+}
+
+
+bool parseDouble(const std::string& text, double minimum, double& value)
+{
+  char* end = nullptr;
+  errno = 0;
+  const auto parsed = std::strtod(text.c_str(), &end);
+  if (text.empty() || *end != '\0' || errno == ERANGE || !(parsed >= minimum))
+  {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+
+// Nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sortedValues, double fraction)
+{
+  if (sortedValues.empty())
+  {
+    return 0.0;
+  }
+  const auto rank =
+    static_cast<std::size_t>(fraction * double(sortedValues.size() - 1) + 0.5);
+  return sortedValues[std::min(rank, sortedValues.size() - 1)];
+}
+
+
+// Reads the median time of each benchmark from a JSON report written by main()
+std::map<std::string, double> readMedians(const std::string& json)
+{
+  std::map<std::string, double> medians;
+  const std::string nameKey = "{\"name\": \"";
+  const std::string medianKey = "\"median\": ";
+  for (auto position = json.find(nameKey); position != std::string::npos;
+       position = json.find(nameKey, position))
+  {
+    position += nameKey.size();
+    const auto nameEnd = json.find('"', position);
+    const auto medianPosition = json.find(medianKey, nameEnd);
+    if (nameEnd == std::string::npos || medianPosition == std::string::npos)
+    {
+      break;
+    }
+    medians[json.substr(position, nameEnd - position)] =
+      std::strtod(json.c_str() + medianPosition + medianKey.size(), nullptr);
+  }
+  return medians;
+}
+
+
+// Compares the median times with the ones of the baseline and returns false if at least
+// one benchmark is slower than the baseline by more than tolerancePercent
+bool compareWithBaseline(const std::map<std::string, double>& medians,
+                         const std::string& baselineJson, double tolerancePercent)
+{
+  const auto baselineMedians = readMedians(baselineJson);
+
+  auto withinTolerance = true;
+  for (const auto& median : medians)
+  {
+    const auto baselineMedian = baselineMedians.find(median.first);
+    if (baselineMedian == baselineMedians.end() || baselineMedian->second <= 0.0)
+    {
+      std::cerr << median.first << ": no baseline" << std::endl;
+      continue;
+    }
+
+    const auto ratio = median.second / baselineMedian->second;
+    const auto slower = ratio > 1.0 + tolerancePercent / 100.0;
+    std::cerr << median.first << ": " << ratio << "x baseline"
+              << (slower ? " (slower than the tolerance allows)" : "") << std::endl;
+    if (slower)
+    {
+      withinTolerance = false;
+    }
+  }
+  return withinTolerance;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  const std::vector<std::string> args{argv, argv + argc};
+
+  if (!checkOptions(args))
+  {
+    printUsage(args.at(0));
+    return 1;
+  }
+
+  auto warmup = 10;
+  auto repetitions = 100;
+  auto tolerancePercent = 10.0;
+
+  if (!parseInt(getArgument(args, "--warmup", "10"), 0, warmup)
+      || !parseInt(getArgument(args, "--repetitions", "100"), 1, repetitions)
+      || !parseDouble(getArgument(args, "--tolerance", "10"), 0.0, tolerancePercent))
+  {
+    std::cerr << "Invalid value for --warmup, --repetitions or --tolerance" << std::endl;
+    printUsage(args.at(0));
+    return 1;
+  }
+
+  const auto filter = getArgument(args, "--filter", "");
+
+  std::map<std::string, double> medians;
+  std::ostringstream json;
+  json << "{\"warmup\": " << warmup << ", \"repetitions\": " << repetitions
+       << ", \"benchmarks\": [";
+
+  auto first = true;
+  for (const auto& registration : frut::benchmark::getRegistrations())
+  {
+    const std::string name = registration.name;
+    if (name.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+
+    frut::benchmark::State state{warmup, repetitions};
+    registration.function(state);
+
+    auto nanoseconds = state.getNanoseconds();
+    std::sort(nanoseconds.begin(), nanoseconds.end());
+    const auto mean = nanoseconds.empty()
+                        ? 0.0
+                        : std::accumulate(nanoseconds.begin(), nanoseconds.end(), 0.0)
+                            / double(nanoseconds.size());
+    const auto median = percentile(nanoseconds, 0.5);
+
+    json << (first ? "" : ", ") << "{\"name\": \"" << name
+         << "\", \"items_per_repetition\": " << state.getItemsPerRepetition()
+         << ", \"ns\": {\"min\": " << percentile(nanoseconds, 0.0)
+         << ", \"median\": " << median << ", \"mean\": " << mean
+         << ", \"p90\": " << percentile(nanoseconds, 0.9)
+         << ", \"max\": " << percentile(nanoseconds, 1.0) << "}, \"ns_per_item\": "
+         << median / double(std::max<std::int64_t>(1, state.getItemsPerRepetition()))
+         << "}";
+    first = false;
+    medians[name] = median;
+
+    std::cerr << name << ": " << median << " ns (median)" << std::endl;
+  }
+
+  json << "]}";
+
+  const auto outputPath = getArgument(args, "--output", "");
+  if (outputPath.empty())
+  {
+    std::cout << json.str() << std::endl;
+  }
+  else
+  {
+    std::ofstream output{outputPath};
+    output << json.str() << std::endl;
+    if (!output)
+    {
+      return 1;
+    }
+  }
+
+  const auto baselinePath = getArgument(args, "--baseline", "");
+  if (baselinePath.empty())
+  {
+    return 0;
+  }
+
+  std::ifstream baselineInput{baselinePath};
+  if (!baselineInput || hasArgument(args, "--update-baseline"))
+  {
+    baselineInput.close();
+    std::ofstream baselineOutput{baselinePath};
+    baselineOutput << json.str() << std::endl;
+    std::cerr << "Wrote baseline " << baselinePath << std::endl;
+    return baselineOutput ? 0 : 1;
+  }
+
+  const std::string baselineJson{std::istreambuf_iterator<char>{baselineInput},
+                                 std::istreambuf_iterator<char>{}};
+  return compareWithBaseline(medians, baselineJson, tolerancePercent) ? 0 : 1;
+}
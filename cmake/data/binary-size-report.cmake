@@ -0,0 +1,290 @@
+# Copyright (C) 2026  Alain Martin
+#
+# This file is part of FRUT.
+#
+# FRUT is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# FRUT is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+# Run after building a target by Reprojucer.cmake when JUCER_BINARY_SIZE_REPORT is ON or
+# when BINARY_SIZE_BUDGET is set:
+#
+#   cmake
+#     -DTARGET_NAME=<target>
+#     -DTARGET_FILE=<binary>
+#     -DREPORT_FILE=<json-file>
+#     -DBUDGET=<size-in-bytes>  # optional, empty for no budget
+#     -DSYMBOLS=<ON|OFF>  # optional, defaults to ON, OFF to only read the section sizes
+#     -DMODULES=<module>[,<module>...]
+#     -DNM=<nm> -DREADELF=<readelf> -DCXXFILT=<c++filt>  # CXXFILT is optional
+#     -DLARGEST_SYMBOLS_COUNT=<count>  # optional, defaults to 20
+#     -P binary-size-report.cmake
+
+cmake_minimum_required(VERSION 3.13)
+
+
+function(_read_command_output out_var)
+
+  execute_process(COMMAND ${ARGN}
+    OUTPUT_VARIABLE output
+    ERROR_QUIET
+    RESULT_VARIABLE result
+  )
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to run ${ARGN}")
+  endif()
+  # Brackets and semicolons would break CMake list handling below
+  string(REGEX REPLACE "[][;]" "_" output "${output}")
+  string(REGEX MATCHALL "[^\n]+" lines "${output}")
+  set(${out_var} "${lines}" PARENT_SCOPE)
+
+endfunction()
+
+
+function(_zero_pad value out_var)
+
+  string(LENGTH "${value}" length)
+  math(EXPR padding_length "16 - ${length}")
+  if(padding_length GREATER 0)
+    string(REPEAT "0" ${padding_length} padding)
+    set(value "${padding}${value}")
+  endif()
+  set(${out_var} "${value}" PARENT_SCOPE)
+
+endfunction()
+
+
+# Sums the sizes of the given "nm --print-size --radix=d" lines with a single math()
+# call, since running CMake commands for each of the tens of thousands of symbols of a
+# plugin takes seconds
+function(_sum_sizes lines out_var)
+
+  if(NOT lines)
+    set(${out_var} 0 PARENT_SCOPE)
+    return()
+  endif()
+  list(TRANSFORM lines REPLACE "^[0-9]+ 0*([0-9]+) .*$" "\\1")
+  list(JOIN lines "+" expression)
+  math(EXPR sum "${expression}")
+  set(${out_var} ${sum} PARENT_SCOPE)
+
+endfunction()
+
+
+function(_json_string text out_var)
+
+  string(REPLACE "\\" "\\\\" text "${text}")
+  string(REPLACE "\"" "\\\"" text "${text}")
+  set(${out_var} "\"${text}\"" PARENT_SCOPE)
+
+endfunction()
+
+
+foreach(var IN ITEMS TARGET_NAME TARGET_FILE REPORT_FILE NM READELF)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "${var} must be defined")
+  endif()
+endforeach()
+string(REPLACE "," ";" MODULES "${MODULES}")
+if(NOT DEFINED SYMBOLS)
+  set(SYMBOLS ON)
+endif()
+if(NOT DEFINED LARGEST_SYMBOLS_COUNT)
+  set(LARGEST_SYMBOLS_COUNT 20)
+endif()
+
+
+# Section sizes
+_read_command_output(section_lines "${READELF}" "--wide" "--sections" "${TARGET_FILE}")
+set(section_names ".text" ".rodata" ".data" ".data.rel.ro" ".bss")
+foreach(section IN LISTS section_names)
+  set(size_of_${section} 0)
+endforeach()
+set(section_regex
+  "^ *_ *[0-9]+_ ([^ ]+) +[A-Z_0-9]+ +[0-9a-f]+ +[0-9a-f]+ +([0-9a-f]+)"
+)
+foreach(line IN LISTS section_lines)
+  if(line MATCHES "${section_regex}")
+    set(section "${CMAKE_MATCH_1}")
+    if(section IN_LIST section_names)
+      math(EXPR size_of_${section} "0x${CMAKE_MATCH_2}")
+    endif()
+  endif()
+endforeach()
+math(EXPR loaded_size
+  "${size_of_.text} + ${size_of_.rodata} + ${size_of_.data} + ${size_of_.data.rel.ro}"
+)
+
+
+# Dynamic relocations and exported symbols
+_read_command_output(relocation_lines "${READELF}" "--wide" "--relocs" "${TARGET_FILE}")
+set(relocations 0)
+foreach(line IN LISTS relocation_lines)
+  if(line MATCHES "^[0-9a-f]+ +[0-9a-f]+ +R_")
+    math(EXPR relocations "${relocations} + 1")
+  endif()
+endforeach()
+
+_read_command_output(exported_lines
+  "${NM}" "--dynamic" "--defined-only" "${TARGET_FILE}"
+)
+list(LENGTH exported_lines exported_symbols)
+
+
+# Symbols, largest first, grouped by JUCE module or by source file when the binary has
+# debug information
+set(largest_symbols "")
+set(sorted_groups "")
+if(SYMBOLS)
+  _read_command_output(symbol_lines
+    "${NM}" "--print-size" "--size-sort" "--reverse-sort" "--radix=d" "--line-numbers"
+    "${TARGET_FILE}"
+  )
+  list(FILTER symbol_lines INCLUDE REGEX "^[0-9]+ [0-9]+ [A-Za-z] ")
+
+  list(LENGTH symbol_lines symbols_count)
+  if(symbols_count GREATER LARGEST_SYMBOLS_COUNT)
+    list(SUBLIST symbol_lines 0 ${LARGEST_SYMBOLS_COUNT} largest_symbol_lines)
+  else()
+    set(largest_symbol_lines "${symbol_lines}")
+  endif()
+  foreach(line IN LISTS largest_symbol_lines)
+    if(line MATCHES "^[0-9]+ ([0-9]+) [A-Za-z] ([^\t]+)")
+      math(EXPR size "${CMAKE_MATCH_1}") # strips nm's zero padding
+      list(APPEND largest_symbols "${size}|${CMAKE_MATCH_2}")
+    endif()
+  endforeach()
+
+  # The symbols of the JUCE modules and the ones without debug information are grouped
+  # with list operations, only the remaining ones are grouped one by one
+  set(groups "")
+  foreach(module IN LISTS MODULES)
+    set(module_regex "\t[^\t]*/${module}/[^\t]*:[0-9]+$")
+    set(module_lines "${symbol_lines}")
+    list(FILTER module_lines INCLUDE REGEX "${module_regex}")
+    if(module_lines)
+      list(FILTER symbol_lines EXCLUDE REGEX "${module_regex}")
+      string(MAKE_C_IDENTIFIER "${module}" group_id)
+      _sum_sizes("${module_lines}" group_size_${group_id})
+      list(APPEND groups "${module}")
+    endif()
+  endforeach()
+
+  set(unknown_lines "${symbol_lines}")
+  list(FILTER unknown_lines EXCLUDE REGEX "\t.+:[0-9]+$")
+  if(unknown_lines)
+    list(FILTER symbol_lines INCLUDE REGEX "\t.+:[0-9]+$")
+    string(MAKE_C_IDENTIFIER "<unknown>" group_id)
+    _sum_sizes("${unknown_lines}" group_size_${group_id})
+    list(APPEND groups "<unknown>")
+  endif()
+
+  foreach(line IN LISTS symbol_lines)
+    if(NOT line MATCHES "^[0-9]+ ([0-9]+) [A-Za-z] [^\t]+\t(.+):[0-9]+$")
+      continue()
+    endif()
+    string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_2}" group_id)
+    if(NOT DEFINED group_size_${group_id})
+      set(group_size_${group_id} 0)
+      list(APPEND groups "${CMAKE_MATCH_2}")
+    endif()
+    math(EXPR group_size_${group_id} "${group_size_${group_id}} + ${CMAKE_MATCH_1}")
+  endforeach()
+
+  foreach(group IN LISTS groups)
+    string(MAKE_C_IDENTIFIER "${group}" group_id)
+    _zero_pad("${group_size_${group_id}}" padded_size)
+    list(APPEND sorted_groups "${padded_size}|${group}")
+  endforeach()
+  list(SORT sorted_groups)
+  list(REVERSE sorted_groups)
+endif()
+
+
+# Report
+set(report "${TARGET_NAME} (${TARGET_FILE}):\n")
+string(APPEND report "  .text ${size_of_.text}, .rodata ${size_of_.rodata}")
+string(APPEND report ", .data ${size_of_.data}, .data.rel.ro ${size_of_.data.rel.ro}")
+string(APPEND report ", .bss ${size_of_.bss} bytes\n")
+string(APPEND report "  ${relocations} dynamic relocations")
+string(APPEND report ", ${exported_symbols} exported symbols\n")
+
+_json_string("${TARGET_NAME}" json_target)
+_json_string("${TARGET_FILE}" json_file)
+set(json "{\"target\": ${json_target}, \"file\": ${json_file}, \"sections\": {")
+set(separator "")
+foreach(section IN LISTS section_names)
+  string(APPEND json "${separator}\"${section}\": ${size_of_${section}}")
+  set(separator ", ")
+endforeach()
+string(APPEND json "}, \"loaded_size\": ${loaded_size}")
+string(APPEND json ", \"dynamic_relocations\": ${relocations}")
+string(APPEND json ", \"exported_symbols\": ${exported_symbols}")
+
+if(SYMBOLS)
+  string(APPEND report "  largest symbols:\n")
+  string(APPEND json ", \"largest_symbols\": [")
+  set(separator "")
+  foreach(entry IN LISTS largest_symbols)
+    string(FIND "${entry}" "|" bar_index)
+    string(SUBSTRING "${entry}" 0 ${bar_index} size)
+    math(EXPR name_index "${bar_index} + 1")
+    string(SUBSTRING "${entry}" ${name_index} -1 symbol)
+    if(CXXFILT)
+      execute_process(COMMAND "${CXXFILT}" "${symbol}"
+        OUTPUT_VARIABLE symbol OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET
+      )
+    endif()
+    string(APPEND report "    ${size} ${symbol}\n")
+    _json_string("${symbol}" json_symbol)
+    string(APPEND json "${separator}{\"symbol\": ${json_symbol}, \"size\": ${size}}")
+    set(separator ", ")
+  endforeach()
+  string(APPEND json "]")
+
+  string(APPEND report "  size by JUCE module / source file:\n")
+  string(APPEND json ", \"size_by_group\": [")
+  set(separator "")
+  set(index 0)
+  foreach(entry IN LISTS sorted_groups)
+    string(FIND "${entry}" "|" bar_index)
+    string(SUBSTRING "${entry}" 0 ${bar_index} size)
+    math(EXPR size "${size}")
+    math(EXPR name_index "${bar_index} + 1")
+    string(SUBSTRING "${entry}" ${name_index} -1 group)
+    if(index LESS LARGEST_SYMBOLS_COUNT)
+      string(APPEND report "    ${size} ${group}\n")
+    endif()
+    _json_string("${group}" json_group)
+    string(APPEND json "${separator}{\"group\": ${json_group}, \"size\": ${size}}")
+    set(separator ", ")
+    math(EXPR index "${index} + 1")
+  endforeach()
+  string(APPEND json "]")
+endif()
+
+if(NOT "${BUDGET}" STREQUAL "")
+  string(APPEND json ", \"budget\": ${BUDGET}")
+  string(APPEND report "  loaded size ${loaded_size} bytes, budget ${BUDGET} bytes\n")
+endif()
+string(APPEND json "}\n")
+
+file(WRITE "${REPORT_FILE}" "${json}")
+message("${report}  report written to ${REPORT_FILE}")
+
+if(NOT "${BUDGET}" STREQUAL "" AND loaded_size GREATER BUDGET)
+  math(EXPR excess "${loaded_size} - ${BUDGET}")
+  message(FATAL_ERROR "${TARGET_NAME} exceeds its binary size budget by ${excess} bytes"
+    " (.text + .rodata + .data + .data.rel.ro = ${loaded_size} bytes, budget ="
+    " ${BUDGET} bytes)"
+  )
+endif()
@@ -0,0 +1,301 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// <target>_EditorBenchmark: times how long it takes to construct, lay out and paint the
+// editor of an "Audio Plug-in" project, or the main window content of a "GUI
+// Application" project, and prints a JSON report. Painting uses JUCE's software renderer
+// at each requested scale factor. With --per-component, the paint time of every
+// component of the tree is reported as well.
+//
+// When DISPLAY is not set, the benchmark runs itself again under xvfb-run (a virtual X
+// server), unless --no-xvfb is given.
+//
+// usage: <target>_EditorBenchmark [--repaints <count>]
+//                                 [--scales 1,1.5,2]
+//                                 [--per-component]
+//                                 [--no-xvfb]
+//                                 [--output <json-file>]
+
+#include "audio_plugin_harness.h"
+
+#include <cstdlib>
+#include <typeinfo>
+
+#if JUCE_LINUX
+  #include <unistd.h>
+#endif
+
+
+#if FRUT_EDITOR_BENCHMARK_GUI_APPLICATION
+// Defined by START_JUCE_APPLICATION(), which doesn't define main() because
+// JUCE_GUI_APPLICATION_DEFINE_CUSTOM_MAIN is defined
+juce::JUCEApplicationBase* juce_CreateApplication();
+#endif
+
+
+namespace
+{
+
+std::vector<double> parseScales(const juce::String& text)
+{
+  std::vector<double> scales;
+  for (const auto& token : juce::StringArray::fromTokens(text, ",", {}))
+  {
+    if (token.trim().getDoubleValue() > 0.0)
+    {
+      scales.push_back(token.trim().getDoubleValue());
+    }
+  }
+  return scales;
+}
+
+
+// Paints the component and its children into a software image, and returns how long
+// the painting took
+std::int64_t paint(juce::Component& component, juce::Image& image, double scale)
+{
+  using namespace frut::harness;
+
+  image.clear(image.getBounds());
+  juce::Graphics g{image};
+  g.addTransform(juce::AffineTransform::scale(float(scale)));
+
+  const auto start = Clock::now();
+  component.paintEntireComponent(g, true);
+  return nanosecondsSince(start);
+}
+
+
+juce::Image createImage(const juce::Component& component, double scale)
+{
+  return juce::Image{juce::Image::ARGB,
+                     std::max(1, juce::roundToInt(component.getWidth() * scale)),
+                     std::max(1, juce::roundToInt(component.getHeight() * scale)), true,
+                     juce::SoftwareImageType{}};
+}
+
+
+juce::var measureRepaints(juce::Component& component, double scale, int numRepaints)
+{
+  using namespace frut::harness;
+
+  auto image = createImage(component, scale);
+  std::vector<double> nanoseconds;
+  for (auto i = 0; i < numRepaints; ++i)
+  {
+    nanoseconds.push_back(double(paint(component, image, scale)));
+  }
+
+  const auto maxNanoseconds =
+    nanoseconds.empty() ? 0.0 : *std::max_element(nanoseconds.begin(), nanoseconds.end());
+
+  auto result = makeObject();
+  setProperty(result, "scale", scale);
+  setProperty(result, "p50_ns", percentile(nanoseconds, 0.50));
+  setProperty(result, "p90_ns", percentile(nanoseconds, 0.90));
+  setProperty(result, "max_ns", maxNanoseconds);
+  return result;
+}
+
+
+// Appends the paint time of the component (including its children) and of each of its
+// visible descendants to "timings". "path" is the index of each component in its
+// parent, e.g. "0/3/1".
+void measureComponents(juce::Component& component, const juce::String& path,
+                       int numRepaints, juce::var& timings)
+{
+  using namespace frut::harness;
+
+  if (component.getWidth() <= 0 || component.getHeight() <= 0)
+  {
+    return;
+  }
+
+  auto image = createImage(component, 1.0);
+  std::vector<double> nanoseconds;
+  for (auto i = 0; i < numRepaints; ++i)
+  {
+    nanoseconds.push_back(double(paint(component, image, 1.0)));
+  }
+
+  auto timing = makeObject();
+  setProperty(timing, "path", path);
+  setProperty(timing, "name", component.getName());
+  setProperty(timing, "type", juce::String{typeid(component).name()});
+  setProperty(timing, "width", component.getWidth());
+  setProperty(timing, "height", component.getHeight());
+  setProperty(timing, "p50_ns", percentile(nanoseconds, 0.50));
+  timings.append(timing);
+
+  for (auto i = 0; i < component.getNumChildComponents(); ++i)
+  {
+    auto* child = component.getChildComponent(i);
+    if (child->isVisible())
+    {
+      measureComponents(*child, path + "/" + juce::String{i}, numRepaints, timings);
+    }
+  }
+}
+
+
+juce::var benchmarkComponent(juce::Component& component,
+                             const frut::harness::CommandLine& commandLine)
+{
+  using namespace frut::harness;
+
+  const auto numRepaints =
+    std::max(1, commandLine.getValue("--repaints", "50").getIntValue());
+  const auto scales = parseScales(commandLine.getValue("--scales", "1,1.5,2"));
+
+  auto result = makeObject();
+  setProperty(result, "width", component.getWidth());
+  setProperty(result, "height", component.getHeight());
+
+  const auto layoutStart = Clock::now();
+  component.resized();
+  setProperty(result, "first_layout_ns", double(nanosecondsSince(layoutStart)));
+
+  auto firstImage = createImage(component, 1.0);
+  setProperty(result, "first_paint_ns", double(paint(component, firstImage, 1.0)));
+
+  juce::var repaints;
+  for (const auto scale : scales)
+  {
+    repaints.append(measureRepaints(component, scale, numRepaints));
+  }
+  setProperty(result, "repaints", repaints);
+
+  if (commandLine.hasFlag("--per-component"))
+  {
+    juce::var timings;
+    measureComponents(component, "0", std::max(1, numRepaints / 10), timings);
+    setProperty(result, "components", timings);
+  }
+
+  return result;
+}
+
+
+#if JUCE_LINUX
+// Runs the benchmark again with the same arguments under xvfb-run when there is no X
+// display. Only returns if that's not needed or not possible.
+void reexecuteUnderXvfbIfNeeded(int argc, char* argv[],
+                                const frut::harness::CommandLine& commandLine)
+{
+  if (std::getenv("DISPLAY") != nullptr || commandLine.hasFlag("--no-xvfb")
+      || std::getenv("FRUT_EDITOR_BENCHMARK_UNDER_XVFB") != nullptr)
+  {
+    return;
+  }
+
+  setenv("FRUT_EDITOR_BENCHMARK_UNDER_XVFB", "1", 1);
+  std::vector<char*> args;
+  args.push_back(const_cast<char*>("xvfb-run"));
+  args.push_back(const_cast<char*>("--auto-servernum"));
+  args.push_back(const_cast<char*>("--server-args=-screen 0 1920x1080x24"));
+  for (auto i = 0; i < argc; ++i)
+  {
+    args.push_back(argv[i]);
+  }
+  args.push_back(nullptr);
+  execvp(args[0], args.data());
+
+  std::cerr << "warning: DISPLAY is not set and xvfb-run could not be run" << std::endl;
+}
+#endif
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  using namespace frut::harness;
+
+  const CommandLine commandLine{argc, argv};
+
+#if JUCE_LINUX
+  reexecuteUnderXvfbIfNeeded(argc, argv, commandLine);
+#endif
+
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  auto report = makeObject();
+
+#if FRUT_EDITOR_BENCHMARK_GUI_APPLICATION
+  setProperty(report, "application", ProjectInfo::projectName);
+  setProperty(report, "version", ProjectInfo::versionString);
+
+  const auto constructionStart = Clock::now();
+  std::unique_ptr<juce::JUCEApplicationBase> application{juce_CreateApplication()};
+  application->initialise({});
+  setProperty(report, "construction_ns", double(nanosecondsSince(constructionStart)));
+
+  juce::Component* component = nullptr;
+  auto& desktop = juce::Desktop::getInstance();
+  for (auto i = 0; i < desktop.getNumComponents() && component == nullptr; ++i)
+  {
+    if (auto* window = dynamic_cast<juce::ResizableWindow*>(desktop.getComponent(i)))
+    {
+      component = window->getContentComponent();
+    }
+  }
+  if (component == nullptr && desktop.getNumComponents() > 0)
+  {
+    component = desktop.getComponent(0);
+  }
+  if (component == nullptr)
+  {
+    std::cerr << "The application didn't open any window" << std::endl;
+    application->shutdown();
+    return 1;
+  }
+
+  setProperty(report, "main_component", benchmarkComponent(*component, commandLine));
+
+  application->shutdown();
+  application.reset();
+#else
+  setProperty(report, "plugin", JucePlugin_Name);
+  setProperty(report, "version", JucePlugin_VersionString);
+
+  auto processor = createProcessor();
+  if (!processor->hasEditor())
+  {
+    std::cerr << "The plugin doesn't have an editor" << std::endl;
+    return 1;
+  }
+  processor->setRateAndBufferSizeDetails(48000.0, 512);
+  processor->prepareToPlay(48000.0, 512);
+
+  const auto constructionStart = Clock::now();
+  std::unique_ptr<juce::AudioProcessorEditor> editor{processor->createEditorIfNeeded()};
+  setProperty(report, "construction_ns", double(nanosecondsSince(constructionStart)));
+
+  if (editor == nullptr)
+  {
+    std::cerr << "createEditor() returned nullptr" << std::endl;
+    return 1;
+  }
+
+  setProperty(report, "editor", benchmarkComponent(*editor, commandLine));
+
+  editor.reset();
+  processor->releaseResources();
+#endif
+
+  return writeReport(commandLine, report);
+}
@@ -0,0 +1,63 @@
+# Copyright (C) 2026  Alain Martin
+#
+# This file is part of FRUT.
+#
+# FRUT is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# FRUT is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+# Run after building a target by Reprojucer.cmake when SPLIT_DEBUG_INFO is ON:
+#
+#   cmake
+#     -DENABLED=<ON|empty>  # empty when SPLIT_DEBUG_INFO is OFF for the current config
+#     -DTARGET_FILE=<binary>
+#     -DDEBUG_INFO_DIR=<dir>
+#     -DOBJCOPY=<objcopy> -DREADELF=<readelf>
+#     -P split-debug-info.cmake
+#
+# Moves the debug info of <binary> to <dir>/.build-id/<xx>/<rest-of-build-id>.debug, the
+# layout used by GDB's debug-file-directory and by debuginfod, then strips <binary> and
+# adds a .gnu_debuglink section to it.
+
+cmake_minimum_required(VERSION 3.4)
+
+
+if(NOT ENABLED)
+  return()
+endif()
+
+execute_process(COMMAND "${READELF}" "--notes" "${TARGET_FILE}"
+  OUTPUT_VARIABLE notes
+  ERROR_QUIET
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "Failed to read the notes of ${TARGET_FILE}")
+endif()
+if(NOT notes MATCHES "Build ID: ([0-9a-f][0-9a-f])([0-9a-f]+)")
+  message(FATAL_ERROR "${TARGET_FILE} has no GNU build-id. Link it with -Wl,--build-id.")
+endif()
+
+set(debug_file "${DEBUG_INFO_DIR}/.build-id/${CMAKE_MATCH_1}/${CMAKE_MATCH_2}.debug")
+get_filename_component(debug_file_dir "${debug_file}" DIRECTORY)
+file(MAKE_DIRECTORY "${debug_file_dir}")
+
+foreach(objcopy_args IN ITEMS
+    "--only-keep-debug;${TARGET_FILE};${debug_file}"
+    "--strip-unneeded;${TARGET_FILE}"
+    "--add-gnu-debuglink=${debug_file};${TARGET_FILE}"
+)
+  execute_process(COMMAND "${OBJCOPY}" ${objcopy_args} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to run ${OBJCOPY} ${objcopy_args}")
+  endif()
+endforeach()
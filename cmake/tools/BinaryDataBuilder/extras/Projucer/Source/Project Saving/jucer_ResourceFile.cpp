@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2019  Alain Martin
+// Copyright (C) 2017-2019, 2026  Alain Martin
 //
 // This file is part of FRUT.
 //
@@ -17,13 +17,13 @@
 
 // clang-format off
 
-// Lines 30-97, 100-110, 114-128, 132-151, 154-161, 165-173, 177-244, 247-252, 255-271, and 275-289 of this file were copied from
+// Lines 30-72, 78-102, 105-115, 119-133, 137, 142-159, 162-169, 173-181, 185-197, 201-255, 258-263, 266-282, and 286-300 of this file were copied from
 // https://github.com/juce-framework/JUCE/blob/4.2.0/extras/Projucer/Source/Project%20Saving/jucer_ResourceFile.cpp
 
-// Lines 292-316, 320-326, 330-344, and 348-365 of this file were copied from
+// Lines 303-327, 331-337, 341-355, 359, and 364-379 of this file were copied from
 // https://github.com/juce-framework/JUCE/blob/5.0.0/extras/Projucer/Source/Project%20Saving/jucer_ResourceFile.cpp
 
-// Lines 368-392, 396-402, 406-420, 424-448, 452-458, 462-470, and 474-559 of this file were copied from
+// Lines 382-406, 410-416, 420-434, 438, 443-465, 469-475, 479-487, 491-503, and 507-579 of this file were copied from
 // https://github.com/juce-framework/JUCE/blob/5.3.2/extras/Projucer/Source/ProjectSaving/jucer_ResourceFile.cpp
 
 
@@ -70,6 +70,11 @@ void ResourceFile::setClassName (const String& name)
     className = name;
 }
 
+void ResourceFile::setExternSizes (bool shouldUseExternSizes)
+{
+    externSizes = shouldUseExternSizes;
+}
+
 void ResourceFile::addFile (const File& file)
 {
     files.add (file);
@@ -130,7 +135,10 @@ Result ResourceFile::writeHeader (MemoryOutputStream& header)
             //                      || (ImageFileFormat::findImageFormatForStream (fileStream) != nullptr);
 
             header << "    extern const char*   " << variableName << ";" << newLine;
-            header << "    const int            " << variableName << "Size = " << (int) dataSize << ";" << newLine << newLine;
+            if (externSizes)
+                header << "    extern const int     " << variableName << "Size;" << newLine << newLine;
+            else
+                header << "    const int            " << variableName << "Size = " << (int) dataSize << ";" << newLine << newLine;
         }
     }
 
@@ -187,6 +195,9 @@ Result ResourceFile::writeCpp (MemoryOutputStream& cpp, const File& headerFile,
 
             cpp << newLine << newLine
                 << "const char* " << variableName << " = (const char*) " << tempVariable << ";" << newLine;
+
+            if (externSizes)
+                cpp << "extern const int " << variableName << "Size = " << (int) file.getSize() << ";" << newLine;
         }
 
         ++i;
@@ -346,7 +357,10 @@ Result ResourceFile::writeHeader<ProjucerVersion::v5_0_0> (MemoryOutputStream& h
             //                      || (ImageFileFormat::findImageFormatForStream (fileStream) != nullptr);
 
             header << "    extern const char*   " << variableName << ";" << newLine;
-            header << "    const int            " << variableName << "Size = " << (int) dataSize << ";" << newLine << newLine;
+            if (externSizes)
+                header << "    extern const int     " << variableName << "Size;" << newLine << newLine;
+            else
+                header << "    const int            " << variableName << "Size = " << (int) dataSize << ";" << newLine << newLine;
         }
     }
 
@@ -422,7 +436,10 @@ Result ResourceFile::writeHeader<ProjucerVersion::v5_3_1> (MemoryOutputStream& h
             //                      || (ImageFileFormat::findImageFormatForStream (fileStream) != nullptr);
 
             header << "    extern const char*   " << variableName << ";" << newLine;
-            header << "    const int            " << variableName << "Size = " << (int) dataSize << ";" << newLine << newLine;
+            if (externSizes)
+                header << "    extern const int     " << variableName << "Size;" << newLine << newLine;
+            else
+                header << "    const int            " << variableName << "Size = " << (int) dataSize << ";" << newLine << newLine;
         }
     }
 
@@ -484,6 +501,9 @@ Result ResourceFile::writeCpp<ProjucerVersion::v5_3_1> (MemoryOutputStream& cpp,
 
             cpp << newLine << newLine
                 << "const char* " << variableName << " = (const char*) " << tempVariable << ";" << newLine;
+
+            if (externSizes)
+                cpp << "extern const int " << variableName << "Size = " << (int) file.getSize() << ";" << newLine;
         }
 
         ++i;
@@ -562,3 +582,284 @@ Result ResourceFile::writeCpp<ProjucerVersion::v5_3_1> (MemoryOutputStream& cpp,
 template Result ResourceFile::write<ProjucerVersion::v4_2_0>(Array<File>&, const int);
 template Result ResourceFile::write<ProjucerVersion::v5_0_0>(Array<File>&, const int);
 template Result ResourceFile::write<ProjucerVersion::v5_3_1>(Array<File>&, const int);
+
+
+//==============================================================================
+static void writeOffsetTable (OutputStream& out, const String& name, const Array<int>& offsets)
+{
+    out << "static const unsigned int " << name << "[] =" << newLine
+        << "{";
+
+    for (int i = 0; i < offsets.size(); ++i)
+    {
+        if (i % 16 == 0)
+            out << newLine << "    ";
+
+        out << offsets[i] << (i < offsets.size() - 1 ? ", " : "");
+    }
+
+    out << newLine
+        << "};" << newLine
+        << newLine;
+}
+
+Result ResourceFile::writeRelocationFreeHeader (MemoryOutputStream& header)
+{
+    header << "/* ========================================================================================="
+           << getComment()
+           << "#pragma once" << newLine
+           << newLine
+           << "namespace " << className << newLine
+           << "{" << newLine
+           << "    // The data and the names of the resources are looked up when they are used, so that"   << newLine
+           << "    // they don't need pointers (which are dynamic relocations) in the binary."               << newLine
+           << "    const char* getResourceData (int index) noexcept;"                                         << newLine
+           << "    const char* getResourceName (int index) noexcept;"                                         << newLine
+           << "    const char* getResourceOriginalFilename (int index) noexcept;"                             << newLine
+           << newLine
+           << "    struct ResourceData"                                                                       << newLine
+           << "    {"                                                                                         << newLine
+           << "        int index;"                                                                            << newLine
+           << "        operator const char*() const noexcept  { return getResourceData (index); }"            << newLine
+           << "    };"                                                                                        << newLine
+           << newLine
+           << "    struct ResourceNameList"                                                                   << newLine
+           << "    {"                                                                                         << newLine
+           << "        const char* operator[] (int index) const noexcept  { return getResourceName (index); }" << newLine
+           << "    };"                                                                                        << newLine
+           << newLine
+           << "    struct OriginalFilenameList"                                                               << newLine
+           << "    {"                                                                                         << newLine
+           << "        const char* operator[] (int index) const noexcept  { return getResourceOriginalFilename (index); }" << newLine
+           << "    };"                                                                                        << newLine
+           << newLine;
+
+    for (int i = 0; i < files.size(); ++i)
+    {
+        auto& file = files.getReference (i);
+
+        if (! file.existsAsFile())
+            return Result::fail ("Can't open resource file: " + file.getFullPathName());
+
+        auto variableName = variableNames[i];
+
+        header << "    const ResourceData   " << variableName << " { " << i << " };" << newLine;
+
+        if (externSizes)
+            header << "    extern const int     " << variableName << "Size;" << newLine << newLine;
+        else
+            header << "    const int            " << variableName << "Size = " << (int) file.getSize() << ";" << newLine << newLine;
+    }
+
+    header << "    // Number of elements in the namedResourceList and originalFileNames arrays."                             << newLine
+           << "    const int namedResourceListSize = " << files.size() <<  ";"                                               << newLine
+           << newLine
+           << "    // Behaves like a list of resource names."                                                                << newLine
+           << "    const ResourceNameList namedResourceList {};"                                                             << newLine
+           << newLine
+           << "    // Behaves like a list of resource filenames."                                                            << newLine
+           << "    const OriginalFilenameList originalFilenames {};"                                                         << newLine
+           << newLine
+           << "    // If you provide the name of one of the binary resource variables above, this function will"             << newLine
+           << "    // return the corresponding data and its size (or a null pointer if the name isn't found)."               << newLine
+           << "    const char* getNamedResource (const char* resourceNameUTF8, int& dataSizeInBytes);"                       << newLine
+           << newLine
+           << "    // If you provide the name of one of the binary resource variables above, this function will"             << newLine
+           << "    // return the corresponding original, non-mangled filename (or a null pointer if the name isn't found)."  << newLine
+           << "    const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);"                             << newLine
+           << "}" << newLine;
+
+    return Result::ok();
+}
+
+Result ResourceFile::writeRelocationFree (Array<File>& filesCreated, const int maxFileSize)
+{
+    const File headerFile (project.getBinaryDataHeaderFile());
+
+    {
+        MemoryOutputStream mo;
+        Result r (writeRelocationFreeHeader (mo));
+
+        if (r.failed())
+            return r;
+
+        if (! FileHelpers::overwriteFileWithNewDataIfDifferent (headerFile, mo))
+            return Result::fail ("Can't write to file: " + headerFile.getFullPathName());
+
+        filesCreated.add (headerFile);
+    }
+
+    // Each .cpp file stores the data of its resources in a single array. Like with the
+    // default layout, a new file is started once the current one is larger than
+    // maxFileSize, and each resource is followed by a null character.
+    Array<MemoryBlock> blobs;
+    Array<StringArray> blobFileNames;
+    Array<int> blobIndices;
+    Array<int> dataOffsets;
+    int currentBlobSourceSize = 0;
+
+    for (int i = 0; i < files.size(); ++i)
+    {
+        auto& file = files.getReference (i);
+
+        MemoryBlock data;
+
+        if (! file.loadFileAsData (data))
+            return Result::fail ("Can't open resource file: " + file.getFullPathName());
+
+        if (blobs.isEmpty() || currentBlobSourceSize > maxFileSize)
+        {
+            blobs.add (MemoryBlock());
+            blobFileNames.add (StringArray());
+            currentBlobSourceSize = 0;
+        }
+
+        auto& blob = blobs.getReference (blobs.size() - 1);
+        blobIndices.add (blobs.size() - 1);
+        dataOffsets.add ((int) blob.getSize());
+        blob.append (data.getData(), data.getSize());
+        blob.append ("", 1);
+        blobFileNames.getReference (blobs.size() - 1).add (file.getFileName());
+
+        MemoryOutputStream literal;
+        CodeHelpers::writeDataAsCppLiteral (data, literal, true, true);
+        currentBlobSourceSize += (int) literal.getDataSize();
+    }
+
+    MemoryBlock strings;
+    Array<int> nameOffsets;
+    Array<int> originalFilenameOffsets;
+
+    for (int i = 0; i < files.size(); ++i)
+    {
+        nameOffsets.add ((int) strings.getSize());
+        strings.append (variableNames[i].toRawUTF8(), variableNames[i].getNumBytesAsUTF8() + 1);
+
+        originalFilenameOffsets.add ((int) strings.getSize());
+        const auto originalFilename = files.getReference (i).getFileName();
+        strings.append (originalFilename.toRawUTF8(), originalFilename.getNumBytesAsUTF8() + 1);
+    }
+
+    for (int blobIndex = 0; blobIndex < blobs.size(); ++blobIndex)
+    {
+        MemoryOutputStream cpp;
+
+        cpp << "/* ==================================== " << resourceFileIdentifierString << " ===================================="
+            << getComment();
+
+        if (blobIndex == 0)
+            cpp << "#include \"" << headerFile.getFileName() << "\"" << newLine
+                << newLine;
+
+        cpp << "namespace " << className << "_Blobs" << newLine
+            << "{" << newLine
+            << newLine
+            << "//================== " << blobFileNames[blobIndex].joinIntoString (", ") << " ==================" << newLine
+            << "extern const unsigned char blob" << blobIndex << "[] =" << newLine;
+
+        CodeHelpers::writeDataAsCppLiteral (blobs.getReference (blobIndex), cpp, true, true);
+
+        cpp << newLine
+            << newLine;
+
+        if (blobIndex == 0)
+        {
+            for (int otherBlobIndex = 1; otherBlobIndex < blobs.size(); ++otherBlobIndex)
+                cpp << "extern const unsigned char blob" << otherBlobIndex << "[];" << newLine;
+
+            cpp << "}" << newLine
+                << newLine
+                << "namespace " << className << newLine
+                << "{" << newLine
+                << newLine;
+
+            if (externSizes)
+            {
+                for (int i = 0; i < files.size(); ++i)
+                    cpp << "extern const int " << variableNames[i] << "Size = " << (int) files.getReference (i).getSize() << ";" << newLine;
+
+                cpp << newLine;
+            }
+
+            writeOffsetTable (cpp, "blobIndices", blobIndices);
+            writeOffsetTable (cpp, "dataOffsets", dataOffsets);
+            writeOffsetTable (cpp, "nameOffsets", nameOffsets);
+            writeOffsetTable (cpp, "originalFilenameOffsets", originalFilenameOffsets);
+
+            cpp << "static const unsigned char strings[] =" << newLine;
+            CodeHelpers::writeDataAsCppLiteral (strings, cpp, true, true);
+
+            cpp << newLine
+                << newLine
+                << "const char* getResourceData (int index) noexcept" << newLine
+                << "{" << newLine
+                << "    if (index < 0 || index >= namedResourceListSize)" << newLine
+                << "        return nullptr;" << newLine
+                << newLine
+                << "    switch (blobIndices[index])" << newLine
+                << "    {" << newLine;
+
+            for (int blobToResolve = 0; blobToResolve < blobs.size(); ++blobToResolve)
+                cpp << "        case " << blobToResolve << ":  return (const char*) " << className << "_Blobs::blob"
+                    << blobToResolve << " + dataOffsets[index];" << newLine;
+
+            cpp << "        default: break;" << newLine
+                << "    }" << newLine
+                << newLine
+                << "    return nullptr;" << newLine
+                << "}" << newLine
+                << newLine
+                << "const char* getResourceName (int index) noexcept" << newLine
+                << "{" << newLine
+                << "    if (index < 0 || index >= namedResourceListSize)" << newLine
+                << "        return nullptr;" << newLine
+                << newLine
+                << "    return (const char*) strings + nameOffsets[index];" << newLine
+                << "}" << newLine
+                << newLine
+                << "const char* getResourceOriginalFilename (int index) noexcept" << newLine
+                << "{" << newLine
+                << "    if (index < 0 || index >= namedResourceListSize)" << newLine
+                << "        return nullptr;" << newLine
+                << newLine
+                << "    return (const char*) strings + originalFilenameOffsets[index];" << newLine
+                << "}" << newLine
+                << newLine
+                << "const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)" << newLine
+                << "{" << newLine;
+
+            StringArray returnCodes;
+            for (int i = 0; i < files.size(); ++i)
+                returnCodes.add ("numBytes = " + String (files.getReference (i).getSize()) + "; return getResourceData (" + String (i) + ");");
+
+            CodeHelpers::createStringMatcher (cpp, "resourceNameUTF8", variableNames, returnCodes, 4);
+
+            cpp << "    numBytes = 0;" << newLine
+                << "    return nullptr;" << newLine
+                << "}" << newLine
+                << newLine
+                << "const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)" << newLine
+                << "{" << newLine
+                << "    for (int i = 0; i < namedResourceListSize; ++i)" << newLine
+                << "    {" << newLine
+                << "        if (getResourceName (i) == resourceNameUTF8)" << newLine
+                << "            return getResourceOriginalFilename (i);" << newLine
+                << "    }" << newLine
+                << newLine
+                << "    return nullptr;" << newLine
+                << "}" << newLine
+                << newLine;
+        }
+
+        cpp << "}" << newLine;
+
+        const File cppFile (project.getBinaryDataCppFile (blobIndex));
+
+        if (! FileHelpers::overwriteFileWithNewDataIfDifferent (cppFile, cpp))
+            return Result::fail ("Can't write to file: " + cppFile.getFullPathName());
+
+        filesCreated.add (cppFile);
+    }
+
+    return Result::ok();
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2019  Alain Martin
+// Copyright (C) 2017-2019, 2026  Alain Martin
 //
 // This file is part of FRUT.
 //
@@ -17,7 +17,7 @@
 
 // clang-format off
 
-// Lines 24-51, 62-72, 75-82, 85, and 87-91 of this file were copied from
+// Lines 24-51, 62-71, 77, 80-81, 87-92, 96, 98, and 101-104 of this file were copied from
 // https://github.com/juce-framework/JUCE/blob/4.2.0/extras/Projucer/Source/Project%20Saving/jucer_ResourceFile.h
 
 
@@ -69,22 +69,35 @@ public:
     //==============================================================================
     void setClassName (const String& className);
 
+    // Declares the <name>Size constants as "extern const int" in BinaryData.h and defines
+    // them in the BinaryData .cpp files, so that BinaryData.h only changes when resources
+    // are added, removed or renamed
+    void setExternSizes (bool shouldUseExternSizes);
+
     void addFile (const File& file);
 
     template <ProjucerVersion>
     Result write (Array<File>& filesCreated, int maxFileSize);
 
+    // Writes the resources in a layout that doesn't need any dynamic relocation: the data
+    // and the names are stored in a few arrays and looked up through 32-bit offset tables.
+    // The API of BinaryData.h is preserved with small classes that convert to const char*.
+    Result writeRelocationFree (Array<File>& filesCreated, int maxFileSize);
+
     //==============================================================================
 private:
     Array<File> files;
     StringArray variableNames;
     Project& project;
     String className;
+    bool externSizes = false;
 
     template <ProjucerVersion>
     Result writeHeader (MemoryOutputStream&);
     template <ProjucerVersion>
     Result writeCpp (MemoryOutputStream&, const File& headerFile, int& index, int maxFileSize);
+
+    Result writeRelocationFreeHeader (MemoryOutputStream&);
 };
 
 
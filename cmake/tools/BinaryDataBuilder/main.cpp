@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2020  Alain Martin
+// Copyright (C) 2016-2020, 2026  Alain Martin
 //
 // This file is part of FRUT.
 //
@@ -37,6 +37,8 @@ int main(int argc, char* argv[])
               << " <Project-UID>"
               << " <BinaryData.cpp-size-limit>"
               << " <BinaryData-namespace>"
+              << " [--extern-sizes]"
+              << " [--relocation-free]"
               << " <resource-files>..." << std::endl;
     return 1;
   }
@@ -88,7 +90,32 @@ int main(int argc, char* argv[])
   ResourceFile resourceFile{project};
   resourceFile.setClassName(args.at(5));
 
-  for (auto i = 6u; i < args.size(); ++i)
+  auto relocationFree = false;
+  auto firstResourceIndex = 6u;
+  for (; firstResourceIndex < args.size(); ++firstResourceIndex)
+  {
+    const auto& option = args.at(firstResourceIndex);
+    if (option.compare(0, 2, "--") != 0)
+    {
+      break;
+    }
+
+    if (option == "--extern-sizes")
+    {
+      resourceFile.setExternSizes(true);
+    }
+    else if (option == "--relocation-free")
+    {
+      relocationFree = true;
+    }
+    else
+    {
+      std::cerr << "Unknown option: " << option << std::endl;
+      return 1;
+    }
+  }
+
+  for (auto i = firstResourceIndex; i < args.size(); ++i)
   {
     resourceFile.addFile(File{args.at(i)});
   }
@@ -96,11 +123,13 @@ int main(int argc, char* argv[])
   Array<File> binaryDataFiles;
 
   const auto result =
-    jucerVersion < Version{5, 0, 0}
-      ? resourceFile.write<ProjucerVersion::v4_2_0>(binaryDataFiles, maxSize)
-      : jucerVersion < Version{5, 3, 1}
-          ? resourceFile.write<ProjucerVersion::v5_0_0>(binaryDataFiles, maxSize)
-          : resourceFile.write<ProjucerVersion::v5_3_1>(binaryDataFiles, maxSize);
+    relocationFree
+      ? resourceFile.writeRelocationFree(binaryDataFiles, maxSize)
+      : jucerVersion < Version{5, 0, 0}
+          ? resourceFile.write<ProjucerVersion::v4_2_0>(binaryDataFiles, maxSize)
+          : jucerVersion < Version{5, 3, 1}
+              ? resourceFile.write<ProjucerVersion::v5_0_0>(binaryDataFiles, maxSize)
+              : resourceFile.write<ProjucerVersion::v5_3_1>(binaryDataFiles, maxSize);
 
   if (!result.wasOk())
   {
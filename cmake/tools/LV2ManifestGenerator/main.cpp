@@ -0,0 +1,106 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <juce_core/juce_core.h>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+// Same layout as LV2_Descriptor in lv2/core/lv2.h
+struct LV2Descriptor
+{
+  const char* URI;
+  void* (*instantiate)(const LV2Descriptor*, double, const char*, const void* const*);
+  void (*connect_port)(void*, std::uint32_t, void*);
+  void (*activate)(void*);
+  void (*run)(void*, std::uint32_t);
+  void (*deactivate)(void*);
+  void (*cleanup)(void*);
+  const void* (*extension_data)(const char* uri);
+};
+
+using LV2DescriptorProc = const LV2Descriptor* (*)(std::uint32_t);
+
+
+// Extension through which JUCE's LV2 wrapper writes the TTL files of the plugin, see
+// JUCE/modules/juce_audio_processors/format_types/juce_LV2Common.h
+constexpr auto kTurtleRecallURI = "https://lv2-extensions.juce.com/turtle_recall";
+
+struct RecallFeature
+{
+  int (*doRecall)(const char* libraryPath);
+};
+
+} // namespace
+
+
+// Loads an LV2 module built with JUCE, and makes it write manifest.ttl, dsp.ttl (and
+// ui.ttl if it has an editor) in the bundle directory, so that hosts can scan the plugin
+// without loading it
+int main(int argc, char* argv[])
+{
+  if (argc != 2)
+  {
+    std::cerr << "usage: LV2ManifestGenerator"
+              << " <module-binary>" << std::endl;
+    return 1;
+  }
+
+  const std::vector<std::string> args{argv, argv + argc};
+
+  const auto binary = juce::File::getCurrentWorkingDirectory().getChildFile(args.at(1));
+
+  juce::DynamicLibrary library;
+  if (!library.open(binary.getFullPathName()))
+  {
+    std::cerr << "Failed to load " << args.at(1) << std::endl;
+    return 1;
+  }
+
+  const auto getDescriptor =
+    reinterpret_cast<LV2DescriptorProc>(library.getFunction("lv2_descriptor"));
+  const auto descriptor = getDescriptor != nullptr ? getDescriptor(0) : nullptr;
+  if (descriptor == nullptr || descriptor->extension_data == nullptr)
+  {
+    std::cerr << "Failed to get the LV2 descriptor of " << args.at(1) << std::endl;
+    return 1;
+  }
+
+  const auto recallFeature =
+    static_cast<const RecallFeature*>(descriptor->extension_data(kTurtleRecallURI));
+  if (recallFeature == nullptr || recallFeature->doRecall == nullptr)
+  {
+    std::cerr << args.at(1) << " doesn't provide " << kTurtleRecallURI << std::endl;
+    return 1;
+  }
+
+  if (!binary.getParentDirectory().setAsCurrentWorkingDirectory()
+      || recallFeature->doRecall(binary.getFullPathName().toRawUTF8()) != 0)
+  {
+    std::cerr << "Failed to write the TTL files of " << args.at(1) << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,342 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <juce_core/juce_core.h>
+
+#include "pluginterfaces/base/ipluginbase.h"
+
+#if JUCE_MAC
+  #include <CoreFoundation/CoreFoundation.h>
+#endif
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+using GetFactoryProc = Steinberg::IPluginFactory*(PLUGIN_API*)();
+
+
+// Loads the binary of a VST3 bundle the way a host does, and unloads it when destroyed
+class VST3Module
+{
+public:
+  VST3Module(const juce::File& bundle, const juce::File& binary)
+  {
+#if JUCE_MAC
+    juce::ignoreUnused(binary);
+
+    const auto bundlePath = bundle.getFullPathName().toStdString();
+    if (const auto url = CFURLCreateFromFileSystemRepresentation(
+          kCFAllocatorDefault, reinterpret_cast<const UInt8*>(bundlePath.c_str()),
+          CFIndex(bundlePath.size()), true))
+    {
+      mBundle = CFBundleCreate(kCFAllocatorDefault, url);
+      CFRelease(url);
+    }
+    if (mBundle == nullptr || !CFBundleLoadExecutable(mBundle))
+    {
+      return;
+    }
+
+    using BundleEntryProc = bool (*)(CFBundleRef);
+    auto bundleEntry = reinterpret_cast<BundleEntryProc>(
+      CFBundleGetFunctionPointerForName(mBundle, CFSTR("bundleEntry")));
+    if (bundleEntry == nullptr)
+    {
+      bundleEntry = reinterpret_cast<BundleEntryProc>(
+        CFBundleGetFunctionPointerForName(mBundle, CFSTR("BundleEntry")));
+    }
+    if (bundleEntry != nullptr && !bundleEntry(mBundle))
+    {
+      return;
+    }
+    mIsEntered = true;
+
+    mGetFactory = reinterpret_cast<GetFactoryProc>(
+      CFBundleGetFunctionPointerForName(mBundle, CFSTR("GetPluginFactory")));
+#else
+    juce::ignoreUnused(bundle);
+
+    if (!mLibrary.open(binary.getFullPathName()))
+    {
+      return;
+    }
+
+    using ModuleEntryProc = bool (*)(void*);
+    const auto moduleEntry =
+      reinterpret_cast<ModuleEntryProc>(mLibrary.getFunction("ModuleEntry"));
+    if (moduleEntry != nullptr && !moduleEntry(mLibrary.getNativeHandle()))
+    {
+      return;
+    }
+    mIsEntered = true;
+
+    mGetFactory =
+      reinterpret_cast<GetFactoryProc>(mLibrary.getFunction("GetPluginFactory"));
+#endif
+  }
+
+  ~VST3Module()
+  {
+#if JUCE_MAC
+    if (mBundle != nullptr)
+    {
+      if (mIsEntered)
+      {
+        using BundleExitProc = bool (*)();
+        auto bundleExit = reinterpret_cast<BundleExitProc>(
+          CFBundleGetFunctionPointerForName(mBundle, CFSTR("bundleExit")));
+        if (bundleExit == nullptr)
+        {
+          bundleExit = reinterpret_cast<BundleExitProc>(
+            CFBundleGetFunctionPointerForName(mBundle, CFSTR("BundleExit")));
+        }
+        if (bundleExit != nullptr)
+        {
+          bundleExit();
+        }
+      }
+      CFRelease(mBundle);
+    }
+#else
+    if (mIsEntered)
+    {
+      using ModuleExitProc = bool (*)();
+      if (const auto moduleExit =
+            reinterpret_cast<ModuleExitProc>(mLibrary.getFunction("ModuleExit")))
+      {
+        moduleExit();
+      }
+    }
+#endif
+  }
+
+  Steinberg::IPluginFactory* getFactory() const
+  {
+    return mGetFactory != nullptr ? mGetFactory() : nullptr;
+  }
+
+private:
+#if JUCE_MAC
+  CFBundleRef mBundle = nullptr;
+#else
+  juce::DynamicLibrary mLibrary;
+#endif
+  bool mIsEntered = false;
+  GetFactoryProc mGetFactory = nullptr;
+};
+
+
+juce::String fromUTF16(const Steinberg::char16* text)
+{
+  return juce::String{juce::CharPointer_UTF16{
+    reinterpret_cast<const juce::CharPointer_UTF16::CharType*>(text)}};
+}
+
+
+// Same format as FUID::toString() on macOS and Linux
+juce::String cidToString(const Steinberg::TUID cid)
+{
+  return juce::String::toHexString(cid, int(sizeof(Steinberg::TUID)), 0).toUpperCase();
+}
+
+
+juce::var makeObject()
+{
+  return juce::var{new juce::DynamicObject};
+}
+
+
+juce::var toVar(const juce::StringArray& strings)
+{
+  juce::var array{juce::Array<juce::var>{}};
+  for (const auto& string : strings)
+  {
+    array.append(string);
+  }
+  return array;
+}
+
+
+juce::var getFactoryInfo(Steinberg::IPluginFactory& factory)
+{
+  using Steinberg::PFactoryInfo;
+
+  PFactoryInfo info;
+  if (factory.getFactoryInfo(&info) != Steinberg::kResultOk)
+  {
+    return {};
+  }
+
+  auto flags = makeObject();
+  flags.getDynamicObject()->setProperty("Unicode",
+                                        (info.flags & PFactoryInfo::kUnicode) != 0);
+  flags.getDynamicObject()->setProperty(
+    "Classes Discardable", (info.flags & PFactoryInfo::kClassesDiscardable) != 0);
+  flags.getDynamicObject()->setProperty(
+    "Component Non Discardable",
+    (info.flags & PFactoryInfo::kComponentNonDiscardable) != 0);
+
+  auto factoryInfo = makeObject();
+  factoryInfo.getDynamicObject()->setProperty("Vendor", juce::String{info.vendor});
+  factoryInfo.getDynamicObject()->setProperty("URL", juce::String{info.url});
+  factoryInfo.getDynamicObject()->setProperty("E-Mail", juce::String{info.email});
+  factoryInfo.getDynamicObject()->setProperty("Flags", flags);
+  return factoryInfo;
+}
+
+
+// Uses the most detailed class info provided by the factory
+juce::var getClassInfo(Steinberg::IPluginFactory& factory,
+                       Steinberg::IPluginFactory2* factory2,
+                       Steinberg::IPluginFactory3* factory3, Steinberg::int32 index)
+{
+  using namespace Steinberg;
+
+  auto classInfo = makeObject();
+  auto& object = *classInfo.getDynamicObject();
+
+  PClassInfoW infoW;
+  PClassInfo2 info2;
+  PClassInfo info;
+  if (factory3 != nullptr && factory3->getClassInfoUnicode(index, &infoW) == kResultOk)
+  {
+    object.setProperty("CID", cidToString(infoW.cid));
+    object.setProperty("Category", juce::String{infoW.category});
+    object.setProperty("Name", fromUTF16(infoW.name));
+    object.setProperty("Vendor", fromUTF16(infoW.vendor));
+    object.setProperty("Version", fromUTF16(infoW.version));
+    object.setProperty("SDKVersion", fromUTF16(infoW.sdkVersion));
+    object.setProperty(
+      "Sub Categories",
+      toVar(juce::StringArray::fromTokens(juce::String{infoW.subCategories}, "|", "")));
+    object.setProperty("Class Flags", int(infoW.classFlags));
+    object.setProperty("Cardinality", int(infoW.cardinality));
+  }
+  else if (factory2 != nullptr && factory2->getClassInfo2(index, &info2) == kResultOk)
+  {
+    object.setProperty("CID", cidToString(info2.cid));
+    object.setProperty("Category", juce::String{info2.category});
+    object.setProperty("Name", juce::String{info2.name});
+    object.setProperty("Vendor", juce::String{info2.vendor});
+    object.setProperty("Version", juce::String{info2.version});
+    object.setProperty("SDKVersion", juce::String{info2.sdkVersion});
+    object.setProperty(
+      "Sub Categories",
+      toVar(juce::StringArray::fromTokens(juce::String{info2.subCategories}, "|", "")));
+    object.setProperty("Class Flags", int(info2.classFlags));
+    object.setProperty("Cardinality", int(info2.cardinality));
+  }
+  else if (factory.getClassInfo(index, &info) == kResultOk)
+  {
+    object.setProperty("CID", cidToString(info.cid));
+    object.setProperty("Category", juce::String{info.category});
+    object.setProperty("Name", juce::String{info.name});
+    object.setProperty("Cardinality", int(info.cardinality));
+  }
+  else
+  {
+    return {};
+  }
+
+  object.setProperty("Snapshots", juce::var{juce::Array<juce::var>{}});
+  return classInfo;
+}
+
+} // namespace
+
+
+// Writes <name>.vst3/Contents/Resources/moduleinfo.json, so that hosts can scan the
+// module without loading it
+int main(int argc, char* argv[])
+{
+  if (argc != 3)
+  {
+    std::cerr << "usage: VST3ModuleInfoGenerator"
+              << " <module-binary>"
+              << " <module-version>" << std::endl;
+    return 1;
+  }
+
+  const std::vector<std::string> args{argv, argv + argc};
+
+  const auto binary = juce::File::getCurrentWorkingDirectory().getChildFile(args.at(1));
+  const auto& moduleVersion = args.at(2);
+
+  // <name>.vst3/Contents/(MacOS|<arch>-linux)/<binary>
+  const auto bundle =
+    binary.getParentDirectory().getParentDirectory().getParentDirectory();
+  const auto outputFile = bundle.getChildFile("Contents/Resources/moduleinfo.json");
+
+  const VST3Module module{bundle, binary};
+
+  const auto factory = module.getFactory();
+  if (factory == nullptr)
+  {
+    std::cerr << "Failed to get the plugin factory of " << args.at(1) << std::endl;
+    return 1;
+  }
+
+  Steinberg::IPluginFactory2* factory2 = nullptr;
+  Steinberg::IPluginFactory3* factory3 = nullptr;
+  factory->queryInterface(Steinberg::IPluginFactory2_iid,
+                          reinterpret_cast<void**>(&factory2));
+  factory->queryInterface(Steinberg::IPluginFactory3_iid,
+                          reinterpret_cast<void**>(&factory3));
+
+  juce::var classes{juce::Array<juce::var>{}};
+  for (auto i = Steinberg::int32{0}; i < factory->countClasses(); ++i)
+  {
+    const auto classInfo = getClassInfo(*factory, factory2, factory3, i);
+    if (classInfo.isObject())
+    {
+      classes.append(classInfo);
+    }
+  }
+
+  auto moduleInfo = makeObject();
+  moduleInfo.getDynamicObject()->setProperty("Name",
+                                             bundle.getFileNameWithoutExtension());
+  moduleInfo.getDynamicObject()->setProperty("Version", juce::String{moduleVersion});
+  moduleInfo.getDynamicObject()->setProperty("Factory Info", getFactoryInfo(*factory));
+  moduleInfo.getDynamicObject()->setProperty("Compatibility",
+                                             juce::var{juce::Array<juce::var>{}});
+  moduleInfo.getDynamicObject()->setProperty("Classes", classes);
+
+  if (factory3 != nullptr)
+  {
+    factory3->release();
+  }
+  if (factory2 != nullptr)
+  {
+    factory2->release();
+  }
+  factory->release();
+
+  if (!outputFile.getParentDirectory().createDirectory()
+      || !outputFile.replaceWithText(juce::JSON::toString(moduleInfo) + "\n"))
+  {
+    std::cerr << "Failed to write " << outputFile.getFullPathName() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
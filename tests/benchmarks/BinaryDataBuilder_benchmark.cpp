@@ -0,0 +1,109 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Times the generation of the BinaryData files from a few large resources and from many
+// small ones
+
+#include "frut_benchmark.h"
+#include "frut_tool_benchmark.h"
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+// Writes count files of size bytes with pseudo-random contents, and returns their paths
+std::vector<std::string> writeResourceFiles(const std::string& prefix, int count,
+                                            std::size_t size)
+{
+  std::mt19937 generator{42};
+  std::vector<std::string> paths;
+  for (auto i = 0; i < count; ++i)
+  {
+    paths.push_back(std::string{FRUT_BENCHMARK_WORK_DIR} + "/" + prefix
+                    + std::to_string(i) + ".bin");
+    std::vector<char> contents(size);
+    for (auto& byte : contents)
+    {
+      byte = static_cast<char>(generator());
+    }
+    std::ofstream file{paths.back(), std::ios::binary};
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+  }
+  return paths;
+}
+
+
+void benchmarkBinaryDataBuilder(frut::benchmark::State& state,
+                                const std::vector<std::string>& resourceFiles,
+                                std::size_t resourceFileSize, bool relocationFree)
+{
+  std::vector<std::string> command{FRUT_TOOL_EXE,
+                                   "latest",
+                                   std::string{FRUT_BENCHMARK_WORK_DIR} + "/",
+                                   "BENCHMARK",
+                                   "10485760",
+                                   "BinaryData"};
+  if (relocationFree)
+  {
+    command.push_back("--relocation-free");
+  }
+  command.insert(command.end(), resourceFiles.begin(), resourceFiles.end());
+
+  state.setItemsPerRepetition(
+    static_cast<std::int64_t>(resourceFiles.size() * resourceFileSize));
+  state.measure([&] { frut::tool_benchmark::run(command); });
+}
+
+
+constexpr auto kLargeFileSize = std::size_t{4 * 1024 * 1024};
+constexpr auto kSmallFileSize = std::size_t{32 * 1024};
+
+} // namespace
+
+
+FRUT_BENCHMARK(BinaryDataBuilder_largeFiles)
+{
+  const auto resourceFiles = writeResourceFiles("large", 4, kLargeFileSize);
+  benchmarkBinaryDataBuilder(state, resourceFiles, kLargeFileSize, false);
+}
+
+
+FRUT_BENCHMARK(BinaryDataBuilder_smallFiles)
+{
+  const auto resourceFiles = writeResourceFiles("small", 32, kSmallFileSize);
+  benchmarkBinaryDataBuilder(state, resourceFiles, kSmallFileSize, false);
+}
+
+
+FRUT_BENCHMARK(BinaryDataBuilder_largeFiles_relocationFree)
+{
+  const auto resourceFiles = writeResourceFiles("large", 4, kLargeFileSize);
+  benchmarkBinaryDataBuilder(state, resourceFiles, kLargeFileSize, true);
+}
+
+
+FRUT_BENCHMARK(BinaryDataBuilder_smallFiles_relocationFree)
+{
+  const auto resourceFiles = writeResourceFiles("small", 32, kSmallFileSize);
+  benchmarkBinaryDataBuilder(state, resourceFiles, kSmallFileSize, true);
+}
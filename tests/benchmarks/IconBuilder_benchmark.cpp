@@ -0,0 +1,52 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Times the generation of the icon files from a small PNG image and a large SVG image
+
+#include "frut_benchmark.h"
+#include "frut_tool_benchmark.h"
+
+#include <string>
+
+
+namespace
+{
+
+void benchmarkIconBuilder(frut::benchmark::State& state, const std::string& iconFormat)
+{
+  const auto sourceDir = std::string{FRUT_SOURCE_DIR};
+  state.measure([&] {
+    frut::tool_benchmark::run(
+      {FRUT_TOOL_EXE, "latest", iconFormat, FRUT_BENCHMARK_WORK_DIR,
+       sourceDir + "/Jucer2CMake/tests/guiapp6/Source/icons/32x32.png",
+       sourceDir + "/FRUT.svg"});
+  });
+}
+
+} // namespace
+
+
+FRUT_BENCHMARK(IconBuilder_icns)
+{
+  benchmarkIconBuilder(state, "icns");
+}
+
+
+FRUT_BENCHMARK(IconBuilder_ico)
+{
+  benchmarkIconBuilder(state, "ico");
+}
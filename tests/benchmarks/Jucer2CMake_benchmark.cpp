@@ -0,0 +1,57 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Times the conversion of the test jucers with both modes of Jucer2CMake
+
+#include "frut_benchmark.h"
+#include "frut_tool_benchmark.h"
+
+#include <cstdint>
+#include <string>
+
+
+using frut::tool_benchmark::run;
+using frut::tool_benchmark::splitPaths;
+
+
+FRUT_BENCHMARK(Jucer2CMake_reprojucer)
+{
+  const auto jucerFiles = splitPaths(FRUT_REPROJUCER_JUCERS);
+  state.setItemsPerRepetition(static_cast<std::int64_t>(jucerFiles.size()));
+  state.measure([&] {
+    for (const auto& jucerFile : jucerFiles)
+    {
+      // Jucer2CMake writes CMakeLists.txt in the current working directory
+      const auto jucerDir = jucerFile.substr(0, jucerFile.find_last_of('/'));
+      run({FRUT_CMAKE_COMMAND, "-E", "chdir", jucerDir, FRUT_TOOL_EXE, "reprojucer",
+           jucerFile, FRUT_REPROJUCER_FILE});
+    }
+  });
+}
+
+
+FRUT_BENCHMARK(Jucer2CMake_juce6)
+{
+  const auto jucerFiles = splitPaths(FRUT_JUCE6_JUCERS);
+  state.setItemsPerRepetition(static_cast<std::int64_t>(jucerFiles.size()));
+  state.measure([&] {
+    for (const auto& jucerFile : jucerFiles)
+    {
+      run({FRUT_TOOL_EXE, "juce6", jucerFile});
+    }
+  });
+}
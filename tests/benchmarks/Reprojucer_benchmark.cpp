@@ -0,0 +1,58 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Times the re-configuration of the test projects with Reprojucer.cmake
+
+#include "frut_benchmark.h"
+#include "frut_tool_benchmark.h"
+
+#include <cstdint>
+#include <string>
+
+
+using frut::tool_benchmark::run;
+using frut::tool_benchmark::splitPaths;
+
+
+FRUT_BENCHMARK(Reprojucer_configure)
+{
+  const auto projectDirs = splitPaths(FRUT_REPROJUCER_PROJECTS);
+  const auto getBuildDir = [](const std::string& projectDir) {
+    return std::string{FRUT_BENCHMARK_WORK_DIR} + "/"
+           + projectDir.substr(projectDir.find_last_of('/') + 1);
+  };
+
+  for (const auto& projectDir : projectDirs)
+  {
+    run({FRUT_CMAKE_COMMAND, "-E", "make_directory", getBuildDir(projectDir)});
+  }
+
+  const auto configure = [&] {
+    for (const auto& projectDir : projectDirs)
+    {
+      run({FRUT_CMAKE_COMMAND, "-E", "chdir", getBuildDir(projectDir),
+           FRUT_CMAKE_COMMAND, projectDir});
+    }
+  };
+
+  // The first configuration (including the detection of the compiler) isn't timed, so
+  // that each repetition measures a re-configuration, like after editing CMakeLists.txt
+  configure();
+
+  state.setItemsPerRepetition(static_cast<std::int64_t>(projectDirs.size()));
+  state.measure(configure);
+}
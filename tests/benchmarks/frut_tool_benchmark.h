@@ -0,0 +1,78 @@
+// Copyright (C) 2026  Alain Martin
+//
+// This file is part of FRUT.
+//
+// FRUT is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// FRUT is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with FRUT.  If not, see <http://www.gnu.org/licenses/>.
+
+// Helpers shared by the benchmarks of FRUT's tools (see tests/benchmarks/CMakeLists.txt)
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+namespace frut
+{
+namespace tool_benchmark
+{
+
+// Splits a list of paths separated by '|' (CMake lists can't be passed as compile
+// definitions since ';' separates the definitions)
+inline std::vector<std::string> splitPaths(const std::string& paths)
+{
+  std::vector<std::string> result;
+  std::string::size_type begin = 0;
+  while (begin <= paths.size())
+  {
+    const auto end = std::min(paths.find('|', begin), paths.size());
+    if (end > begin)
+    {
+      result.push_back(paths.substr(begin, end - begin));
+    }
+    begin = end + 1;
+  }
+  return result;
+}
+
+
+// Runs command without printing its output, and exits if it fails so that the test of
+// the benchmark fails as well
+inline void run(const std::vector<std::string>& command)
+{
+  std::string commandLine;
+  for (const auto& argument : command)
+  {
+    commandLine += (commandLine.empty() ? "\"" : " \"") + argument + "\"";
+  }
+
+#if defined(_WIN32)
+  // cmd.exe strips the first and last quotes of the command line
+  const auto status = std::system(("\"" + commandLine + " > NUL 2>&1\"").c_str());
+#else
+  const auto status = std::system((commandLine + " > /dev/null 2>&1").c_str());
+#endif
+
+  if (status != 0)
+  {
+    std::cerr << "Failed to run " << commandLine << std::endl;
+    std::exit(1);
+  }
+}
+
+} // namespace tool_benchmark
+} // namespace frut